@@ -0,0 +1,26 @@
+/*
+  *@ai overview
+  *           move pickers without any game side effects, sessionAiStep()
+  *           in session.cpp wraps them, host tools call them directly
+  *                 |-> aiBestMove()   perfect play from the move table, or a
+  *                                    whole runtime search (blocks)
+  *                 |-> aiRandomMove() any empty cell, from the caller's Rng
+  *           on a host the search and transposition table are per thread
+  *           (HAL_THREAD_LOCAL), so these can run on every core at once
+  *
+*/
+
+#ifndef AI_H
+#define AI_H
+
+#include "bitboard.h"
+#include "rng.h"
+
+// best cell, -1 if the game is over
+// score -> utility() scale, X wins > 0, quicker wins score higher
+int aiBestMove(const Board &board, int &score);
+int aiBestMove(const Board &board);
+// random empty cell, -1 if the board is full
+int aiRandomMove(const Board &board, Rng &rng);
+
+#endif
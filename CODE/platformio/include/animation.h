@@ -0,0 +1,74 @@
+/*
+  *@animation overview
+  *           keyframe player for the led effects, an effect is a short
+  *           AnimFrame array in PROGMEM (see animation.cpp), not code
+  *                 |-> a keyframe paints its cells one colour and holds for
+  *                     a number of ticks, hold 0 goes straight on to the
+  *                     next keyframe in the same tick
+  *                 |-> ANIM_JUMP goes back to keyframe hold, that is how an
+  *                     effect loops
+  *                 |-> colours are either an allColor index or one of the
+  *                     ANIM_* slots filled in from the game by AnimContext
+  *           animTick() runs from the animation task once per ANIM_TICK_US,
+  *           while a keyframe holds it only counts down a byte
+  *
+*/
+
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <stdint.h>
+#include "hardware.h"
+#include "display.h"
+
+const uint32_t ANIM_TICK_US = 20000;  // the animation task's period
+
+// cells of the keyframe, bit x*3+y as in bitboard.h, or the winning line
+const uint16_t ANIM_ALL = 0777;
+const uint16_t ANIM_WIN_LINE = 0x8000;
+
+// colour slots, everything below ANIM_OFF is an index into the palette
+const uint8_t ANIM_OFF = 0xF0;
+const uint8_t ANIM_X = 0xF1;          // X's colour
+const uint8_t ANIM_O = 0xF2;          // O's colour
+const uint8_t ANIM_WINNER = 0xF3;     // colour of whoever won
+const uint8_t ANIM_BOARD = 0xF4;      // X's colour on X's cells, O's on the rest
+const uint8_t ANIM_RANDOM = 0xF5;     // any palette colour, per cell
+const uint8_t ANIM_RANDOM_XO = 0xF6;  // X's or O's colour, per cell
+const uint8_t ANIM_JUMP = 0xFF;       // not a keyframe, go to keyframe hold
+
+// longest run of hold 0 keyframes and jumps animTick() follows in one tick
+const uint8_t ANIM_MAX_CHAIN = 32;
+
+struct AnimFrame {
+  uint16_t cells;
+  uint8_t color;
+  uint8_t hold;    // ticks until the next keyframe
+};
+
+// what the colour slots and ANIM_WIN_LINE stand for while an effect plays
+struct AnimContext {
+  LedColor x;
+  LedColor o;
+  LedColor winner;
+  uint16_t winLine;
+  uint16_t xCells;
+};
+
+// the effects
+extern const AnimFrame ANIM_WIN[] PROGMEM;       // winning line blinks
+extern const AnimFrame ANIM_CATS_GAME[] PROGMEM; // board blinks, then shimmers X/O
+extern const AnimFrame ANIM_PARTY[] PROGMEM;     // random colours everywhere
+extern const AnimFrame ANIM_ATTRACT[] PROGMEM;   // idle start screen chase
+
+void animSeed(uint32_t seed);
+// palette (PROGMEM) for colour indices and ANIM_RANDOM
+void animBegin(const uint8_t (*palette)[RGB], uint8_t size);
+// starts seq from its first keyframe on the next animTick()
+void animPlay(const AnimFrame *seq, const AnimContext &ctx);
+void animStop();
+bool animPlaying();
+// one tick, true if it painted anything into color
+bool animTick(LedColor color[ROW][COL]);
+
+#endif
@@ -0,0 +1,158 @@
+/*
+  *@bitboard overview
+  *           the board is stored as two 9 bit masks, one for X and one for O
+  *           cell (x,y) lives at bit (x*3 + y)
+  *                 |-> e.g. led0 == (0,0) == bit 0, led8 == (2,2) == bit 8
+  *           the masks below are written in octal so each digit is one row
+  *
+*/
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <stdint.h>
+
+const uint8_t BB_SIZE = 3;
+const uint8_t BB_CELLS = 9;
+const uint16_t BB_FULL = 0777;
+const uint8_t BB_NUM_LINES = 8;
+
+// rows, columns and the two diagonals
+constexpr uint16_t BB_LINES[BB_NUM_LINES] = {
+        0007, 0070, 0700,   // rows
+        0111, 0222, 0444,   // columns
+        0421, 0124          // (0,0)->(2,2), (0,2)->(2,0)
+  };
+
+struct Board {
+  uint16_t x; // bit set == X on that cell
+  uint16_t o; // bit set == O on that cell
+};
+
+constexpr uint16_t bbBit(uint8_t cell){
+  return (uint16_t)1 << cell;
+}
+constexpr uint8_t bbCell(int x, int y){
+  return (uint8_t)(x*BB_SIZE + y);
+}
+constexpr bool bbEqual(const Board &a, const Board &b){
+  return a.x == b.x && a.o == b.o;
+}
+inline uint16_t bbEmpty(const Board &b){
+  return (uint16_t)(~(b.x | b.o) & BB_FULL);
+}
+inline uint8_t bbCount(uint16_t mask){
+  return (uint8_t)__builtin_popcount(mask);
+}
+
+// X moves first, so X is on move whenever both sides have the same count
+inline bool bbXTurn(const Board &b){
+  return bbCount(b.x) <= bbCount(b.o);
+}
+
+inline bool bbHasLine(uint16_t mask){
+  for(uint8_t i = 0; i < BB_NUM_LINES; i++){
+    if((mask & BB_LINES[i]) == BB_LINES[i])
+      return true;
+  }
+  return false;
+}
+
+// returns the mask of the first complete line, 0 if there is none
+inline uint16_t bbWinLine(const Board &b){
+  for(uint8_t i = 0; i < BB_NUM_LINES; i++){
+    if((b.x & BB_LINES[i]) == BB_LINES[i] || (b.o & BB_LINES[i]) == BB_LINES[i])
+      return BB_LINES[i];
+  }
+  return 0;
+}
+
+// same convention as the rest of the game: X == 1, O == 0, none == -1
+inline int bbWinner(const Board &b){
+  if(bbHasLine(b.x))
+    return 1;
+  if(bbHasLine(b.o))
+    return 0;
+  return -1;
+}
+
+inline void bbPlace(Board &b, uint8_t cell, bool XO){
+  if(XO){
+    b.x |= bbBit(cell);
+  }else{
+    b.o |= bbBit(cell);
+  }
+}
+inline void bbClear(Board &b, uint8_t cell){
+  b.x &= ~bbBit(cell);
+  b.o &= ~bbBit(cell);
+}
+
+// symmetries -> bit 0 mirrors left/right, bit 1 mirrors top/bottom and
+// bit 2 swaps x and y, applied in that order
+const uint8_t BB_NUM_SYMS = 8;
+
+inline uint16_t bbMirrorY(uint16_t m){
+  return ((m & 0111) << 2) | (m & 0222) | ((m & 0444) >> 2);
+}
+inline uint16_t bbMirrorX(uint16_t m){
+  return ((m & 0007) << 6) | (m & 0070) | ((m & 0700) >> 6);
+}
+inline uint16_t bbTranspose(uint16_t m){
+  return (m & 0421) | ((m & 0042) << 2) | ((m & 0210) >> 2)
+       | ((m & 0004) << 4) | ((m & 0100) >> 4);
+}
+inline uint16_t bbTransform(uint16_t m, uint8_t sym){
+  if(sym & 1)
+    m = bbMirrorY(m);
+  if(sym & 2)
+    m = bbMirrorX(m);
+  if(sym & 4)
+    m = bbTranspose(m);
+  return m;
+}
+inline uint16_t bbUntransform(uint16_t m, uint8_t sym){
+  if(sym & 4)
+    m = bbTranspose(m);
+  if(sym & 2)
+    m = bbMirrorX(m);
+  if(sym & 1)
+    m = bbMirrorY(m);
+  return m;
+}
+// smallest (x, o) pair over all 8 symmetries, returns the symmetry used
+inline uint8_t bbCanonical(const Board &b, Board &canon){
+  uint8_t best = 0;
+  canon = b;
+  for(uint8_t sym = 1; sym < BB_NUM_SYMS; sym++){
+    uint16_t x = bbTransform(b.x, sym);
+    if(x > canon.x)
+      continue;
+    uint16_t o = bbTransform(b.o, sym);
+    if(x < canon.x || o < canon.o){
+      canon.x = x;
+      canon.o = o;
+      best = sym;
+    }
+  }
+  return best;
+}
+
+// adapter for code that still thinks in board[x][y] == 1/0/-1
+inline int bbGet(const Board &b, int x, int y){
+  uint16_t bit = bbBit(bbCell(x, y));
+  if(b.x & bit)
+    return 1;
+  if(b.o & bit)
+    return 0;
+  return -1;
+}
+inline void bbToArray(const Board &b, int board[BB_SIZE][BB_SIZE]){
+  for(int i = 0; i < BB_SIZE; i++){
+    for(int j = 0; j < BB_SIZE; j++){
+      board[i][j] = bbGet(b, i, j);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,1532 @@
+/*
+  *@book4 overview
+  *           GENERATED by tools/solver4, do not edit
+  *           perfect play for 4x4 tic-tac-toe (four in a row), every
+  *           position with at most 5 pieces that the game
+  *           is not over in, one per symmetry class
+  *                 |-> key  == x mask << 16 | o mask, cell (x,y) == bit x*4 + y
+  *                     only the smallest key over the 8 symmetries is
+  *                     stored (same symmetry order as bitboard.h),
+  *                     sorted for a binary search
+  *                 |-> info == best cell of the stored key (bits 0-3)
+  *                            | result for the side to move (bits 4-5,
+  *                              1 win, 2 loss, 3 draw)
+  *                            | plies to the end (bits 6-10)
+  *           7183 entries, 43098 bytes of flash
+  *
+*/
+
+#ifndef BOOK4_H
+#define BOOK4_H
+
+#include <stdint.h>
+#include "hal.h"
+
+const uint8_t BOOK4_PLIES = 5;
+const uint8_t BOOK4_EMPTIES = 0;
+const uint16_t BOOK4_SIZE = 7183;
+
+const uint32_t BOOK4_KEYS[BOOK4_SIZE] PROGMEM = {
+        0x00000000, 0x00010000, 0x00010002, 0x00010004, 0x00010008, 0x00010020, 0x00010040, 0x00010080,
+        0x00010400, 0x00010800, 0x00018000, 0x00020000, 0x00020001, 0x00020004, 0x00020008, 0x00020010,
+        0x00020020, 0x00020040, 0x00020080, 0x00020100, 0x00020200, 0x00020400, 0x00020800, 0x00021000,
+        0x00022000, 0x00024000, 0x00028000, 0x00030004, 0x00030008, 0x0003000c, 0x00030010, 0x00030014,
+        0x00030018, 0x00030020, 0x00030024, 0x00030028, 0x00030030, 0x00030040, 0x00030044, 0x00030048,
+        0x00030050, 0x00030060, 0x00030080, 0x00030084, 0x00030088, 0x00030090, 0x000300a0, 0x000300c0,
+        0x00030100, 0x00030104, 0x00030108, 0x00030110, 0x00030120, 0x00030140, 0x00030180, 0x00030200,
+        0x00030204, 0x00030208, 0x00030210, 0x00030220, 0x00030240, 0x00030280, 0x00030300, 0x00030400,
+        0x00030404, 0x00030408, 0x00030410, 0x00030420, 0x00030440, 0x00030480, 0x00030500, 0x00030600,
+        0x00030800, 0x00030804, 0x00030808, 0x00030810, 0x00030820, 0x00030840, 0x00030880, 0x00030900,
+        0x00030a00, 0x00030c00, 0x00031000, 0x00031004, 0x00031008, 0x00031010, 0x00031020, 0x00031040,
+        0x00031080, 0x00031100, 0x00031200, 0x00031400, 0x00031800, 0x00032000, 0x00032004, 0x00032008,
+        0x00032010, 0x00032020, 0x00032040, 0x00032080, 0x00032100, 0x00032200, 0x00032400, 0x00032800,
+        0x00033000, 0x00034000, 0x00034004, 0x00034008, 0x00034010, 0x00034020, 0x00034040, 0x00034080,
+        0x00034100, 0x00034200, 0x00034400, 0x00034800, 0x00035000, 0x00036000, 0x00038000, 0x00038004,
+        0x00038008, 0x00038010, 0x00038020, 0x00038040, 0x00038080, 0x00038100, 0x00038200, 0x00038400,
+        0x00038800, 0x00039000, 0x0003a000, 0x0003c000, 0x00050002, 0x00050008, 0x0005000a, 0x00050010,
+        0x00050012, 0x00050018, 0x00050020, 0x00050022, 0x00050028, 0x00050030, 0x00050040, 0x00050042,
+        0x00050048, 0x00050050, 0x00050060, 0x00050080, 0x00050082, 0x00050088, 0x00050090, 0x000500a0,
+        0x000500c0, 0x00050100, 0x00050102, 0x00050108, 0x00050110, 0x00050120, 0x00050140, 0x00050180,
+        0x00050200, 0x00050202, 0x00050208, 0x00050210, 0x00050220, 0x00050240, 0x00050280, 0x00050300,
+        0x00050400, 0x00050402, 0x00050408, 0x00050410, 0x00050420, 0x00050440, 0x00050480, 0x00050500,
+        0x00050600, 0x00050800, 0x00050802, 0x00050808, 0x00050810, 0x00050820, 0x00050840, 0x00050880,
+        0x00050900, 0x00050a00, 0x00050c00, 0x00051000, 0x00051002, 0x00051008, 0x00051010, 0x00051020,
+        0x00051040, 0x00051080, 0x00051100, 0x00051200, 0x00051400, 0x00051800, 0x00052000, 0x00052002,
+        0x00052008, 0x00052010, 0x00052020, 0x00052040, 0x00052080, 0x00052100, 0x00052200, 0x00052400,
+        0x00052800, 0x00053000, 0x00054000, 0x00054002, 0x00054008, 0x00054010, 0x00054020, 0x00054040,
+        0x00054080, 0x00054100, 0x00054200, 0x00054400, 0x00054800, 0x00055000, 0x00056000, 0x00058000,
+        0x00058002, 0x00058008, 0x00058010, 0x00058020, 0x00058040, 0x00058080, 0x00058100, 0x00058200,
+        0x00058400, 0x00058800, 0x00059000, 0x0005a000, 0x0005c000, 0x00060001, 0x00060009, 0x00060010,
+        0x00060011, 0x00060018, 0x00060020, 0x00060021, 0x00060028, 0x00060030, 0x00060050, 0x00060060,
+        0x00060090, 0x00060100, 0x00060101, 0x00060108, 0x00060110, 0x00060120, 0x00060140, 0x00060180,
+        0x00060200, 0x00060201, 0x00060208, 0x00060210, 0x00060220, 0x00060240, 0x00060280, 0x00060300,
+        0x00060500, 0x00060600, 0x00060900, 0x00061000, 0x00061001, 0x00061008, 0x00061010, 0x00061020,
+        0x00061040, 0x00061080, 0x00061100, 0x00061200, 0x00061400, 0x00061800, 0x00062000, 0x00062001,
+        0x00062008, 0x00062010, 0x00062020, 0x00062040, 0x00062080, 0x00062100, 0x00062200, 0x00062400,
+        0x00062800, 0x00063000, 0x00065000, 0x00066000, 0x00069000, 0x00070018, 0x00070028, 0x00070030,
+        0x00070048, 0x00070050, 0x00070060, 0x00070088, 0x00070090, 0x000700a0, 0x000700c0, 0x00070108,
+        0x00070110, 0x00070120, 0x00070140, 0x00070180, 0x00070208, 0x00070210, 0x00070220, 0x00070240,
+        0x00070280, 0x00070300, 0x00070408, 0x00070410, 0x00070420, 0x00070440, 0x00070480, 0x00070500,
+        0x00070600, 0x00070808, 0x00070810, 0x00070820, 0x00070840, 0x00070880, 0x00070900, 0x00070a00,
+        0x00070c00, 0x00071008, 0x00071010, 0x00071020, 0x00071040, 0x00071080, 0x00071100, 0x00071200,
+        0x00071400, 0x00071800, 0x00072008, 0x00072010, 0x00072020, 0x00072040, 0x00072080, 0x00072100,
+        0x00072200, 0x00072400, 0x00072800, 0x00073000, 0x00074008, 0x00074010, 0x00074020, 0x00074040,
+        0x00074080, 0x00074100, 0x00074200, 0x00074400, 0x00074800, 0x00075000, 0x00076000, 0x00078008,
+        0x00078010, 0x00078020, 0x00078040, 0x00078080, 0x00078100, 0x00078200, 0x00078400, 0x00078800,
+        0x00079000, 0x0007a000, 0x0007c000, 0x00090002, 0x00090006, 0x00090010, 0x00090012, 0x00090014,
+        0x00090020, 0x00090022, 0x00090024, 0x00090030, 0x00090050, 0x00090060, 0x00090090, 0x00090100,
+        0x00090102, 0x00090104, 0x00090110, 0x00090120, 0x00090140, 0x00090180, 0x00090200, 0x00090202,
+        0x00090204, 0x00090210, 0x00090220, 0x00090240, 0x00090280, 0x00090300, 0x00090500, 0x00090600,
+        0x00090900, 0x00091000, 0x00091002, 0x00091004, 0x00091010, 0x00091020, 0x00091040, 0x00091080,
+        0x00091100, 0x00091200, 0x00091400, 0x00091800, 0x00092000, 0x00092002, 0x00092004, 0x00092010,
+        0x00092020, 0x00092040, 0x00092080, 0x00092100, 0x00092200, 0x00092400, 0x00092800, 0x00093000,
+        0x00095000, 0x00096000, 0x00099000, 0x000b0014, 0x000b0024, 0x000b0030, 0x000b0044, 0x000b0050,
+        0x000b0060, 0x000b0084, 0x000b0090, 0x000b00a0, 0x000b00c0, 0x000b0104, 0x000b0110, 0x000b0120,
+        0x000b0140, 0x000b0180, 0x000b0204, 0x000b0210, 0x000b0220, 0x000b0240, 0x000b0280, 0x000b0300,
+        0x000b0404, 0x000b0410, 0x000b0420, 0x000b0440, 0x000b0480, 0x000b0500, 0x000b0600, 0x000b0804,
+        0x000b0810, 0x000b0820, 0x000b0840, 0x000b0880, 0x000b0900, 0x000b0a00, 0x000b0c00, 0x000b1004,
+        0x000b1010, 0x000b1020, 0x000b1040, 0x000b1080, 0x000b1100, 0x000b1200, 0x000b1400, 0x000b1800,
+        0x000b2004, 0x000b2010, 0x000b2020, 0x000b2040, 0x000b2080, 0x000b2100, 0x000b2200, 0x000b2400,
+        0x000b2800, 0x000b3000, 0x000b4004, 0x000b4010, 0x000b4020, 0x000b4040, 0x000b4080, 0x000b4100,
+        0x000b4200, 0x000b4400, 0x000b4800, 0x000b5000, 0x000b6000, 0x000b8004, 0x000b8010, 0x000b8020,
+        0x000b8040, 0x000b8080, 0x000b8100, 0x000b8200, 0x000b8400, 0x000b8800, 0x000b9000, 0x000ba000,
+        0x000bc000, 0x00120001, 0x00120004, 0x00120005, 0x00120008, 0x00120009, 0x0012000c, 0x00120020,
+        0x00120021, 0x00120024, 0x00120028, 0x00120040, 0x00120041, 0x00120044, 0x00120048, 0x00120060,
+        0x00120080, 0x00120081, 0x00120084, 0x00120088, 0x001200a0, 0x001200c0, 0x00120104, 0x00120108,
+        0x00120140, 0x00120180, 0x00120208, 0x00120240, 0x00120280, 0x00120400, 0x00120401, 0x00120404,
+        0x00120408, 0x00120420, 0x00120440, 0x00120480, 0x00120800, 0x00120801, 0x00120804, 0x00120808,
+        0x00120820, 0x00120840, 0x00120880, 0x00120900, 0x00120a00, 0x00120c00, 0x00121008, 0x00121080,
+        0x00121800, 0x00122080, 0x00122800, 0x00124800, 0x00128000, 0x00128001, 0x00128004, 0x00128008,
+        0x00128020, 0x00128040, 0x00128080, 0x00128400, 0x00128800, 0x0013000c, 0x00130024, 0x00130028,
+        0x00130044, 0x00130048, 0x00130060, 0x00130084, 0x00130088, 0x001300a0, 0x001300c0, 0x00130104,
+        0x00130108, 0x00130140, 0x00130180, 0x00130208, 0x00130240, 0x00130280, 0x00130404, 0x00130408,
+        0x00130420, 0x00130440, 0x00130480, 0x00130804, 0x00130808, 0x00130820, 0x00130840, 0x00130880,
+        0x00130900, 0x00130a00, 0x00130c00, 0x00131008, 0x00131080, 0x00131800, 0x00132080, 0x00132800,
+        0x00134800, 0x00138004, 0x00138008, 0x00138020, 0x00138040, 0x00138080, 0x00138400, 0x00138800,
+        0x00140001, 0x00140002, 0x00140003, 0x00140008, 0x00140009, 0x0014000a, 0x00140020, 0x00140021,
+        0x00140022, 0x00140028, 0x00140040, 0x00140041, 0x00140042, 0x00140048, 0x00140060, 0x00140080,
+        0x00140081, 0x00140082, 0x00140088, 0x001400a0, 0x001400c0, 0x00140100, 0x00140101, 0x00140102,
+        0x00140108, 0x00140120, 0x00140140, 0x00140180, 0x00140200, 0x00140201, 0x00140202, 0x00140208,
+        0x00140220, 0x00140240, 0x00140280, 0x00140300, 0x00140400, 0x00140401, 0x00140402, 0x00140408,
+        0x00140420, 0x00140440, 0x00140480, 0x00140500, 0x00140600, 0x00140800, 0x00140801, 0x00140802,
+        0x00140808, 0x00140820, 0x00140840, 0x00140880, 0x00140900, 0x00140a00, 0x00140c00, 0x00141000,
+        0x00141001, 0x00141002, 0x00141008, 0x00141020, 0x00141040, 0x00141080, 0x00141100, 0x00141200,
+        0x00141400, 0x00141800, 0x00142000, 0x00142001, 0x00142002, 0x00142008, 0x00142020, 0x00142040,
+        0x00142080, 0x00142100, 0x00142200, 0x00142400, 0x00142800, 0x00143000, 0x00144000, 0x00144001,
+        0x00144002, 0x00144008, 0x00144020, 0x00144040, 0x00144080, 0x00144100, 0x00144200, 0x00144400,
+        0x00144800, 0x00145000, 0x00146000, 0x00148000, 0x00148001, 0x00148002, 0x00148008, 0x00148020,
+        0x00148040, 0x00148080, 0x00148100, 0x00148200, 0x00148400, 0x00148800, 0x00149000, 0x0014a000,
+        0x0014c000, 0x0015000a, 0x00150022, 0x00150028, 0x00150042, 0x00150048, 0x00150060, 0x00150082,
+        0x00150088, 0x001500a0, 0x001500c0, 0x00150102, 0x00150108, 0x00150120, 0x00150140, 0x00150180,
+        0x00150202, 0x00150208, 0x00150220, 0x00150240, 0x00150280, 0x00150300, 0x00150402, 0x00150408,
+        0x00150420, 0x00150440, 0x00150480, 0x00150500, 0x00150600, 0x00150802, 0x00150808, 0x00150820,
+        0x00150840, 0x00150880, 0x00150900, 0x00150a00, 0x00150c00, 0x00151002, 0x00151008, 0x00151020,
+        0x00151040, 0x00151080, 0x00151100, 0x00151200, 0x00151400, 0x00151800, 0x00152002, 0x00152008,
+        0x00152020, 0x00152040, 0x00152080, 0x00152100, 0x00152200, 0x00152400, 0x00152800, 0x00153000,
+        0x00154002, 0x00154008, 0x00154020, 0x00154040, 0x00154080, 0x00154100, 0x00154200, 0x00154400,
+        0x00154800, 0x00155000, 0x00156000, 0x00158002, 0x00158008, 0x00158020, 0x00158040, 0x00158080,
+        0x00158100, 0x00158200, 0x00158400, 0x00158800, 0x00159000, 0x0015a000, 0x0015c000, 0x00160009,
+        0x00160021, 0x00160028, 0x00160041, 0x00160048, 0x00160060, 0x00160081, 0x00160088, 0x001600a0,
+        0x001600c0, 0x00160101, 0x00160108, 0x00160120, 0x00160140, 0x00160180, 0x00160201, 0x00160208,
+        0x00160220, 0x00160240, 0x00160280, 0x00160300, 0x00160401, 0x00160408, 0x00160420, 0x00160440,
+        0x00160480, 0x00160500, 0x00160600, 0x00160801, 0x00160808, 0x00160820, 0x00160840, 0x00160880,
+        0x00160900, 0x00160a00, 0x00160c00, 0x00161001, 0x00161008, 0x00161020, 0x00161040, 0x00161080,
+        0x00161100, 0x00161200, 0x00161400, 0x00161800, 0x00162001, 0x00162008, 0x00162020, 0x00162040,
+        0x00162080, 0x00162100, 0x00162200, 0x00162400, 0x00162800, 0x00163000, 0x00164001, 0x00164008,
+        0x00164020, 0x00164040, 0x00164080, 0x00164100, 0x00164200, 0x00164400, 0x00164800, 0x00165000,
+        0x00166000, 0x00168001, 0x00168008, 0x00168020, 0x00168040, 0x00168080, 0x00168100, 0x00168200,
+        0x00168400, 0x00168800, 0x00169000, 0x0016a000, 0x0016c000, 0x00180001, 0x00180002, 0x00180003,
+        0x00180004, 0x00180005, 0x00180006, 0x00180020, 0x00180021, 0x00180022, 0x00180024, 0x00180040,
+        0x00180041, 0x00180042, 0x00180044, 0x00180060, 0x00180080, 0x00180081, 0x00180082, 0x00180084,
+        0x001800a0, 0x001800c0, 0x00180100, 0x00180101, 0x00180102, 0x00180104, 0x00180120, 0x00180140,
+        0x00180180, 0x00180200, 0x00180201, 0x00180202, 0x00180204, 0x00180220, 0x00180240, 0x00180280,
+        0x00180300, 0x00180400, 0x00180401, 0x00180402, 0x00180404, 0x00180420, 0x00180440, 0x00180480,
+        0x00180500, 0x00180600, 0x00180800, 0x00180801, 0x00180802, 0x00180804, 0x00180820, 0x00180840,
+        0x00180880, 0x00180900, 0x00180a00, 0x00180c00, 0x00181000, 0x00181001, 0x00181002, 0x00181004,
+        0x00181020, 0x00181040, 0x00181080, 0x00181100, 0x00181200, 0x00181400, 0x00181800, 0x00182000,
+        0x00182001, 0x00182002, 0x00182004, 0x00182020, 0x00182040, 0x00182080, 0x00182100, 0x00182200,
+        0x00182400, 0x00182800, 0x00183000, 0x00184000, 0x00184001, 0x00184002, 0x00184004, 0x00184020,
+        0x00184040, 0x00184080, 0x00184100, 0x00184200, 0x00184400, 0x00184800, 0x00185000, 0x00186000,
+        0x00188000, 0x00188001, 0x00188002, 0x00188004, 0x00188020, 0x00188040, 0x00188080, 0x00188100,
+        0x00188200, 0x00188400, 0x00188800, 0x00189000, 0x0018a000, 0x0018c000, 0x00190006, 0x00190022,
+        0x00190024, 0x00190042, 0x00190044, 0x00190060, 0x00190082, 0x00190084, 0x001900a0, 0x001900c0,
+        0x00190102, 0x00190104, 0x00190120, 0x00190140, 0x00190180, 0x00190202, 0x00190204, 0x00190220,
+        0x00190240, 0x00190280, 0x00190300, 0x00190402, 0x00190404, 0x00190420, 0x00190440, 0x00190480,
+        0x00190500, 0x00190600, 0x00190802, 0x00190804, 0x00190820, 0x00190840, 0x00190880, 0x00190900,
+        0x00190a00, 0x00190c00, 0x00191002, 0x00191004, 0x00191020, 0x00191040, 0x00191080, 0x00191100,
+        0x00191200, 0x00191400, 0x00191800, 0x00192002, 0x00192004, 0x00192020, 0x00192040, 0x00192080,
+        0x00192100, 0x00192200, 0x00192400, 0x00192800, 0x00193000, 0x00194002, 0x00194004, 0x00194020,
+        0x00194040, 0x00194080, 0x00194100, 0x00194200, 0x00194400, 0x00194800, 0x00195000, 0x00196000,
+        0x00198002, 0x00198004, 0x00198020, 0x00198040, 0x00198080, 0x00198100, 0x00198200, 0x00198400,
+        0x00198800, 0x00199000, 0x0019a000, 0x0019c000, 0x001a0005, 0x001a0021, 0x001a0024, 0x001a0041,
+        0x001a0044, 0x001a0060, 0x001a0081, 0x001a0084, 0x001a00a0, 0x001a00c0, 0x001a0101, 0x001a0104,
+        0x001a0120, 0x001a0140, 0x001a0180, 0x001a0201, 0x001a0204, 0x001a0220, 0x001a0240, 0x001a0280,
+        0x001a0300, 0x001a0401, 0x001a0404, 0x001a0420, 0x001a0440, 0x001a0480, 0x001a0500, 0x001a0600,
+        0x001a0801, 0x001a0804, 0x001a0820, 0x001a0840, 0x001a0880, 0x001a0900, 0x001a0a00, 0x001a0c00,
+        0x001a1001, 0x001a1004, 0x001a1020, 0x001a1040, 0x001a1080, 0x001a1100, 0x001a1200, 0x001a1400,
+        0x001a1800, 0x001a2001, 0x001a2004, 0x001a2020, 0x001a2040, 0x001a2080, 0x001a2100, 0x001a2200,
+        0x001a2400, 0x001a2800, 0x001a3000, 0x001a4001, 0x001a4004, 0x001a4020, 0x001a4040, 0x001a4080,
+        0x001a4100, 0x001a4200, 0x001a4400, 0x001a4800, 0x001a5000, 0x001a6000, 0x001a8001, 0x001a8004,
+        0x001a8020, 0x001a8040, 0x001a8080, 0x001a8100, 0x001a8200, 0x001a8400, 0x001a8800, 0x001a9000,
+        0x001aa000, 0x001ac000, 0x001c0003, 0x001c0021, 0x001c0022, 0x001c0041, 0x001c0042, 0x001c0060,
+        0x001c0081, 0x001c0082, 0x001c00a0, 0x001c00c0, 0x001c0101, 0x001c0102, 0x001c0120, 0x001c0140,
+        0x001c0180, 0x001c0201, 0x001c0202, 0x001c0220, 0x001c0240, 0x001c0280, 0x001c0300, 0x001c0401,
+        0x001c0402, 0x001c0420, 0x001c0440, 0x001c0480, 0x001c0500, 0x001c0600, 0x001c0801, 0x001c0802,
+        0x001c0820, 0x001c0840, 0x001c0880, 0x001c0900, 0x001c0a00, 0x001c0c00, 0x001c1001, 0x001c1002,
+        0x001c1020, 0x001c1040, 0x001c1080, 0x001c1100, 0x001c1200, 0x001c1400, 0x001c1800, 0x001c2001,
+        0x001c2002, 0x001c2020, 0x001c2040, 0x001c2080, 0x001c2100, 0x001c2200, 0x001c2400, 0x001c2800,
+        0x001c3000, 0x001c4001, 0x001c4002, 0x001c4020, 0x001c4040, 0x001c4080, 0x001c4100, 0x001c4200,
+        0x001c4400, 0x001c4800, 0x001c5000, 0x001c6000, 0x001c8001, 0x001c8002, 0x001c8020, 0x001c8040,
+        0x001c8080, 0x001c8100, 0x001c8200, 0x001c8400, 0x001c8800, 0x001c9000, 0x001ca000, 0x001cc000,
+        0x00200000, 0x00200001, 0x00200002, 0x00200004, 0x00200008, 0x00200040, 0x00200080, 0x00200400,
+        0x00200800, 0x00208000, 0x00210002, 0x00210004, 0x00210006, 0x00210008, 0x0021000a, 0x0021000c,
+        0x00210012, 0x00210014, 0x00210018, 0x00210040, 0x00210042, 0x00210044, 0x00210048, 0x00210050,
+        0x00210080, 0x00210082, 0x00210084, 0x00210088, 0x00210090, 0x002100c0, 0x00210104, 0x00210108,
+        0x00210140, 0x00210180, 0x00210208, 0x00210240, 0x00210280, 0x00210400, 0x00210402, 0x00210404,
+        0x00210408, 0x00210440, 0x00210480, 0x00210800, 0x00210802, 0x00210804, 0x00210808, 0x00210810,
+        0x00210840, 0x00210880, 0x00210900, 0x00210a00, 0x00210c00, 0x00211008, 0x00211080, 0x00211800,
+        0x00212080, 0x00212800, 0x00214800, 0x00218000, 0x00218002, 0x00218004, 0x00218008, 0x00218040,
+        0x00218080, 0x00218400, 0x00218800, 0x00220001, 0x00220004, 0x00220005, 0x00220008, 0x00220009,
+        0x0022000c, 0x00220010, 0x00220011, 0x00220014, 0x00220018, 0x00220040, 0x00220041, 0x00220044,
+        0x00220048, 0x00220050, 0x00220080, 0x00220081, 0x00220084, 0x00220088, 0x00220090, 0x002200c0,
+        0x00220100, 0x00220101, 0x00220104, 0x00220108, 0x00220110, 0x00220140, 0x00220180, 0x00220200,
+        0x00220201, 0x00220204, 0x00220208, 0x00220210, 0x00220240, 0x00220280, 0x00220300, 0x00220400,
+        0x00220401, 0x00220404, 0x00220408, 0x00220410, 0x00220440, 0x00220480, 0x00220500, 0x00220600,
+        0x00220800, 0x00220801, 0x00220804, 0x00220808, 0x00220810, 0x00220840, 0x00220880, 0x00220900,
+        0x00220a00, 0x00220c00, 0x00221000, 0x00221001, 0x00221004, 0x00221008, 0x00221010, 0x00221040,
+        0x00221080, 0x00221100, 0x00221200, 0x00221400, 0x00221800, 0x00222000, 0x00222001, 0x00222004,
+        0x00222008, 0x00222010, 0x00222040, 0x00222080, 0x00222100, 0x00222200, 0x00222400, 0x00222800,
+        0x00223000, 0x00224000, 0x00224001, 0x00224004, 0x00224008, 0x00224010, 0x00224040, 0x00224080,
+        0x00224100, 0x00224200, 0x00224400, 0x00224800, 0x00225000, 0x00226000, 0x00228000, 0x00228001,
+        0x00228004, 0x00228008, 0x00228010, 0x00228040, 0x00228080, 0x00228100, 0x00228200, 0x00228400,
+        0x00228800, 0x00229000, 0x0022a000, 0x0022c000, 0x0023000c, 0x00230014, 0x00230018, 0x00230044,
+        0x00230048, 0x00230050, 0x00230084, 0x00230088, 0x00230090, 0x002300c0, 0x00230104, 0x00230108,
+        0x00230110, 0x00230140, 0x00230180, 0x00230204, 0x00230208, 0x00230210, 0x00230240, 0x00230280,
+        0x00230300, 0x00230404, 0x00230408, 0x00230410, 0x00230440, 0x00230480, 0x00230500, 0x00230600,
+        0x00230804, 0x00230808, 0x00230810, 0x00230840, 0x00230880, 0x00230900, 0x00230a00, 0x00230c00,
+        0x00231004, 0x00231008, 0x00231010, 0x00231040, 0x00231080, 0x00231100, 0x00231200, 0x00231400,
+        0x00231800, 0x00232004, 0x00232008, 0x00232010, 0x00232040, 0x00232080, 0x00232100, 0x00232200,
+        0x00232400, 0x00232800, 0x00233000, 0x00234004, 0x00234008, 0x00234010, 0x00234040, 0x00234080,
+        0x00234100, 0x00234200, 0x00234400, 0x00234800, 0x00235000, 0x00236000, 0x00238004, 0x00238008,
+        0x00238010, 0x00238040, 0x00238080, 0x00238100, 0x00238200, 0x00238400, 0x00238800, 0x00239000,
+        0x0023a000, 0x0023c000, 0x00240001, 0x00240002, 0x00240003, 0x00240008, 0x00240009, 0x0024000a,
+        0x00240010, 0x00240011, 0x00240012, 0x00240018, 0x00240040, 0x00240041, 0x00240042, 0x00240048,
+        0x00240050, 0x00240080, 0x00240081, 0x00240082, 0x00240088, 0x00240090, 0x002400c0, 0x00240100,
+        0x00240101, 0x00240102, 0x00240108, 0x00240110, 0x00240140, 0x00240180, 0x00240200, 0x00240201,
+        0x00240202, 0x00240208, 0x00240210, 0x00240240, 0x00240280, 0x00240300, 0x00240400, 0x00240401,
+        0x00240402, 0x00240408, 0x00240410, 0x00240440, 0x00240480, 0x00240500, 0x00240600, 0x00240800,
+        0x00240801, 0x00240802, 0x00240808, 0x00240810, 0x00240840, 0x00240880, 0x00240900, 0x00240a00,
+        0x00240c00, 0x00241000, 0x00241001, 0x00241002, 0x00241008, 0x00241010, 0x00241040, 0x00241080,
+        0x00241100, 0x00241200, 0x00241400, 0x00241800, 0x00242000, 0x00242001, 0x00242002, 0x00242008,
+        0x00242010, 0x00242040, 0x00242080, 0x00242100, 0x00242200, 0x00242400, 0x00242800, 0x00243000,
+        0x00244000, 0x00244001, 0x00244002, 0x00244008, 0x00244010, 0x00244040, 0x00244080, 0x00244100,
+        0x00244200, 0x00244400, 0x00244800, 0x00245000, 0x00246000, 0x00248000, 0x00248001, 0x00248002,
+        0x00248008, 0x00248010, 0x00248040, 0x00248080, 0x00248100, 0x00248200, 0x00248400, 0x00248800,
+        0x00249000, 0x0024a000, 0x0024c000, 0x0025000a, 0x00250012, 0x00250018, 0x00250042, 0x00250048,
+        0x00250050, 0x00250082, 0x00250088, 0x00250090, 0x002500c0, 0x00250102, 0x00250108, 0x00250110,
+        0x00250140, 0x00250180, 0x00250202, 0x00250208, 0x00250210, 0x00250240, 0x00250280, 0x00250300,
+        0x00250402, 0x00250408, 0x00250410, 0x00250440, 0x00250480, 0x00250500, 0x00250600, 0x00250802,
+        0x00250808, 0x00250810, 0x00250840, 0x00250880, 0x00250900, 0x00250a00, 0x00250c00, 0x00251002,
+        0x00251008, 0x00251010, 0x00251040, 0x00251080, 0x00251100, 0x00251200, 0x00251400, 0x00251800,
+        0x00252002, 0x00252008, 0x00252010, 0x00252040, 0x00252080, 0x00252100, 0x00252200, 0x00252400,
+        0x00252800, 0x00253000, 0x00254002, 0x00254008, 0x00254010, 0x00254040, 0x00254080, 0x00254100,
+        0x00254200, 0x00254400, 0x00254800, 0x00255000, 0x00256000, 0x00258002, 0x00258008, 0x00258010,
+        0x00258040, 0x00258080, 0x00258100, 0x00258200, 0x00258400, 0x00258800, 0x00259000, 0x0025a000,
+        0x0025c000, 0x00260009, 0x00260011, 0x00260018, 0x00260041, 0x00260048, 0x00260050, 0x00260081,
+        0x00260088, 0x00260090, 0x002600c0, 0x00260101, 0x00260108, 0x00260110, 0x00260140, 0x00260180,
+        0x00260201, 0x00260208, 0x00260210, 0x00260240, 0x00260280, 0x00260300, 0x00260401, 0x00260408,
+        0x00260410, 0x00260440, 0x00260480, 0x00260500, 0x00260600, 0x00260801, 0x00260808, 0x00260810,
+        0x00260840, 0x00260880, 0x00260900, 0x00260a00, 0x00260c00, 0x00261001, 0x00261008, 0x00261010,
+        0x00261040, 0x00261080, 0x00261100, 0x00261200, 0x00261400, 0x00261800, 0x00262001, 0x00262008,
+        0x00262010, 0x00262040, 0x00262080, 0x00262100, 0x00262200, 0x00262400, 0x00262800, 0x00263000,
+        0x00264001, 0x00264008, 0x00264010, 0x00264040, 0x00264080, 0x00264100, 0x00264200, 0x00264400,
+        0x00264800, 0x00265000, 0x00266000, 0x00268001, 0x00268008, 0x00268010, 0x00268040, 0x00268080,
+        0x00268100, 0x00268200, 0x00268400, 0x00268800, 0x00269000, 0x0026a000, 0x0026c000, 0x00280001,
+        0x00280002, 0x00280003, 0x00280004, 0x00280005, 0x00280006, 0x00280010, 0x00280011, 0x00280012,
+        0x00280014, 0x00280040, 0x00280041, 0x00280042, 0x00280044, 0x00280050, 0x00280080, 0x00280081,
+        0x00280082, 0x00280084, 0x00280090, 0x002800c0, 0x00280100, 0x00280101, 0x00280102, 0x00280104,
+        0x00280110, 0x00280140, 0x00280180, 0x00280200, 0x00280201, 0x00280202, 0x00280204, 0x00280210,
+        0x00280240, 0x00280280, 0x00280300, 0x00280400, 0x00280401, 0x00280402, 0x00280404, 0x00280410,
+        0x00280440, 0x00280480, 0x00280500, 0x00280600, 0x00280800, 0x00280801, 0x00280802, 0x00280804,
+        0x00280810, 0x00280840, 0x00280880, 0x00280900, 0x00280a00, 0x00280c00, 0x00281000, 0x00281001,
+        0x00281002, 0x00281004, 0x00281010, 0x00281040, 0x00281080, 0x00281100, 0x00281200, 0x00281400,
+        0x00281800, 0x00282000, 0x00282001, 0x00282002, 0x00282004, 0x00282010, 0x00282040, 0x00282080,
+        0x00282100, 0x00282200, 0x00282400, 0x00282800, 0x00283000, 0x00284000, 0x00284001, 0x00284002,
+        0x00284004, 0x00284010, 0x00284040, 0x00284080, 0x00284100, 0x00284200, 0x00284400, 0x00284800,
+        0x00285000, 0x00286000, 0x00288000, 0x00288001, 0x00288002, 0x00288004, 0x00288010, 0x00288040,
+        0x00288080, 0x00288100, 0x00288200, 0x00288400, 0x00288800, 0x00289000, 0x0028a000, 0x0028c000,
+        0x00290006, 0x00290012, 0x00290014, 0x00290042, 0x00290044, 0x00290050, 0x00290082, 0x00290084,
+        0x00290090, 0x002900c0, 0x00290102, 0x00290104, 0x00290110, 0x00290140, 0x00290180, 0x00290202,
+        0x00290204, 0x00290210, 0x00290240, 0x00290280, 0x00290300, 0x00290402, 0x00290404, 0x00290410,
+        0x00290440, 0x00290480, 0x00290500, 0x00290600, 0x00290802, 0x00290804, 0x00290810, 0x00290840,
+        0x00290880, 0x00290900, 0x00290a00, 0x00290c00, 0x00291002, 0x00291004, 0x00291010, 0x00291040,
+        0x00291080, 0x00291100, 0x00291200, 0x00291400, 0x00291800, 0x00292002, 0x00292004, 0x00292010,
+        0x00292040, 0x00292080, 0x00292100, 0x00292200, 0x00292400, 0x00292800, 0x00293000, 0x00294002,
+        0x00294004, 0x00294010, 0x00294040, 0x00294080, 0x00294100, 0x00294200, 0x00294400, 0x00294800,
+        0x00295000, 0x00296000, 0x00298002, 0x00298004, 0x00298010, 0x00298040, 0x00298080, 0x00298100,
+        0x00298200, 0x00298400, 0x00298800, 0x00299000, 0x0029a000, 0x0029c000, 0x002a0005, 0x002a0011,
+        0x002a0014, 0x002a0041, 0x002a0044, 0x002a0050, 0x002a0081, 0x002a0084, 0x002a0090, 0x002a00c0,
+        0x002a0101, 0x002a0104, 0x002a0110, 0x002a0140, 0x002a0180, 0x002a0201, 0x002a0204, 0x002a0210,
+        0x002a0240, 0x002a0280, 0x002a0300, 0x002a0401, 0x002a0404, 0x002a0410, 0x002a0440, 0x002a0480,
+        0x002a0500, 0x002a0600, 0x002a0801, 0x002a0804, 0x002a0810, 0x002a0840, 0x002a0880, 0x002a0900,
+        0x002a0a00, 0x002a0c00, 0x002a1001, 0x002a1004, 0x002a1010, 0x002a1040, 0x002a1080, 0x002a1100,
+        0x002a1200, 0x002a1400, 0x002a1800, 0x002a2001, 0x002a2004, 0x002a2010, 0x002a2040, 0x002a2080,
+        0x002a2100, 0x002a2200, 0x002a2400, 0x002a2800, 0x002a3000, 0x002a4001, 0x002a4004, 0x002a4010,
+        0x002a4040, 0x002a4080, 0x002a4100, 0x002a4200, 0x002a4400, 0x002a4800, 0x002a5000, 0x002a6000,
+        0x002a8001, 0x002a8004, 0x002a8010, 0x002a8040, 0x002a8080, 0x002a8100, 0x002a8200, 0x002a8400,
+        0x002a8800, 0x002a9000, 0x002aa000, 0x002ac000, 0x002c0003, 0x002c0011, 0x002c0012, 0x002c0041,
+        0x002c0042, 0x002c0050, 0x002c0081, 0x002c0082, 0x002c0090, 0x002c00c0, 0x002c0101, 0x002c0102,
+        0x002c0110, 0x002c0140, 0x002c0180, 0x002c0201, 0x002c0202, 0x002c0210, 0x002c0240, 0x002c0280,
+        0x002c0300, 0x002c0401, 0x002c0402, 0x002c0410, 0x002c0440, 0x002c0480, 0x002c0500, 0x002c0600,
+        0x002c0801, 0x002c0802, 0x002c0810, 0x002c0840, 0x002c0880, 0x002c0900, 0x002c0a00, 0x002c0c00,
+        0x002c1001, 0x002c1002, 0x002c1010, 0x002c1040, 0x002c1080, 0x002c1100, 0x002c1200, 0x002c1400,
+        0x002c1800, 0x002c2001, 0x002c2002, 0x002c2010, 0x002c2040, 0x002c2080, 0x002c2100, 0x002c2200,
+        0x002c2400, 0x002c2800, 0x002c3000, 0x002c4001, 0x002c4002, 0x002c4010, 0x002c4040, 0x002c4080,
+        0x002c4100, 0x002c4200, 0x002c4400, 0x002c4800, 0x002c5000, 0x002c6000, 0x002c8001, 0x002c8002,
+        0x002c8010, 0x002c8040, 0x002c8080, 0x002c8100, 0x002c8200, 0x002c8400, 0x002c8800, 0x002c9000,
+        0x002ca000, 0x002cc000, 0x00320005, 0x00320009, 0x0032000c, 0x00320041, 0x00320044, 0x00320048,
+        0x00320081, 0x00320084, 0x00320088, 0x003200c0, 0x00320104, 0x00320108, 0x00320140, 0x00320180,
+        0x00320208, 0x00320240, 0x00320280, 0x00320401, 0x00320404, 0x00320408, 0x00320440, 0x00320480,
+        0x00320801, 0x00320804, 0x00320808, 0x00320840, 0x00320880, 0x00320900, 0x00320a00, 0x00320c00,
+        0x00321008, 0x00321080, 0x00321800, 0x00322080, 0x00322800, 0x00324800, 0x00328001, 0x00328004,
+        0x00328008, 0x00328040, 0x00328080, 0x00328400, 0x00328800, 0x00340003, 0x00340009, 0x0034000a,
+        0x00340041, 0x00340042, 0x00340048, 0x00340081, 0x00340082, 0x00340088, 0x003400c0, 0x00340101,
+        0x00340102, 0x00340108, 0x00340140, 0x00340180, 0x00340201, 0x00340202, 0x00340208, 0x00340240,
+        0x00340280, 0x00340300, 0x00340401, 0x00340402, 0x00340408, 0x00340440, 0x00340480, 0x00340500,
+        0x00340600, 0x00340801, 0x00340802, 0x00340808, 0x00340840, 0x00340880, 0x00340900, 0x00340a00,
+        0x00340c00, 0x00341001, 0x00341002, 0x00341008, 0x00341040, 0x00341080, 0x00341100, 0x00341200,
+        0x00341400, 0x00341800, 0x00342001, 0x00342002, 0x00342008, 0x00342040, 0x00342080, 0x00342100,
+        0x00342200, 0x00342400, 0x00342800, 0x00343000, 0x00344001, 0x00344002, 0x00344008, 0x00344040,
+        0x00344080, 0x00344100, 0x00344200, 0x00344400, 0x00344800, 0x00345000, 0x00346000, 0x00348001,
+        0x00348002, 0x00348008, 0x00348040, 0x00348080, 0x00348100, 0x00348200, 0x00348400, 0x00348800,
+        0x00349000, 0x0034a000, 0x0034c000, 0x00380003, 0x00380005, 0x00380006, 0x00380041, 0x00380042,
+        0x00380044, 0x00380081, 0x00380082, 0x00380084, 0x003800c0, 0x00380101, 0x00380102, 0x00380104,
+        0x00380140, 0x00380180, 0x00380201, 0x00380202, 0x00380204, 0x00380240, 0x00380280, 0x00380300,
+        0x00380401, 0x00380402, 0x00380404, 0x00380440, 0x00380480, 0x00380500, 0x00380600, 0x00380801,
+        0x00380802, 0x00380804, 0x00380840, 0x00380880, 0x00380900, 0x00380a00, 0x00380c00, 0x00381001,
+        0x00381002, 0x00381004, 0x00381040, 0x00381080, 0x00381100, 0x00381200, 0x00381400, 0x00381800,
+        0x00382001, 0x00382002, 0x00382004, 0x00382040, 0x00382080, 0x00382100, 0x00382200, 0x00382400,
+        0x00382800, 0x00383000, 0x00384001, 0x00384002, 0x00384004, 0x00384040, 0x00384080, 0x00384100,
+        0x00384200, 0x00384400, 0x00384800, 0x00385000, 0x00386000, 0x00388001, 0x00388002, 0x00388004,
+        0x00388040, 0x00388080, 0x00388100, 0x00388200, 0x00388400, 0x00388800, 0x00389000, 0x0038a000,
+        0x0038c000, 0x00500001, 0x00500002, 0x00500003, 0x00500004, 0x00500005, 0x00500006, 0x00500008,
+        0x00500009, 0x0050000a, 0x0050000c, 0x00500020, 0x00500021, 0x00500022, 0x00500024, 0x00500028,
+        0x00500080, 0x00500081, 0x00500082, 0x00500084, 0x00500088, 0x005000a0, 0x00500100, 0x00500101,
+        0x00500102, 0x00500104, 0x00500108, 0x00500120, 0x00500180, 0x00500200, 0x00500201, 0x00500202,
+        0x00500204, 0x00500208, 0x00500220, 0x00500280, 0x00500300, 0x00500400, 0x00500401, 0x00500402,
+        0x00500404, 0x00500408, 0x00500420, 0x00500480, 0x00500500, 0x00500600, 0x00500800, 0x00500801,
+        0x00500802, 0x00500804, 0x00500808, 0x00500820, 0x00500880, 0x00500900, 0x00500a00, 0x00500c00,
+        0x00501000, 0x00501001, 0x00501002, 0x00501004, 0x00501008, 0x00501020, 0x00501080, 0x00501100,
+        0x00501200, 0x00501400, 0x00501800, 0x00502000, 0x00502001, 0x00502002, 0x00502004, 0x00502008,
+        0x00502020, 0x00502080, 0x00502100, 0x00502200, 0x00502400, 0x00502800, 0x00503000, 0x00504000,
+        0x00504001, 0x00504002, 0x00504004, 0x00504008, 0x00504020, 0x00504080, 0x00504100, 0x00504200,
+        0x00504400, 0x00504800, 0x00505000, 0x00506000, 0x00508000, 0x00508001, 0x00508002, 0x00508004,
+        0x00508008, 0x00508020, 0x00508080, 0x00508100, 0x00508200, 0x00508400, 0x00508800, 0x00509000,
+        0x0050a000, 0x0050c000, 0x00510006, 0x0051000a, 0x0051000c, 0x00510022, 0x00510024, 0x00510028,
+        0x00510082, 0x00510084, 0x00510088, 0x005100a0, 0x00510102, 0x00510104, 0x00510108, 0x00510120,
+        0x00510180, 0x00510202, 0x00510204, 0x00510208, 0x00510220, 0x00510280, 0x00510300, 0x00510402,
+        0x00510404, 0x00510408, 0x00510420, 0x00510480, 0x00510500, 0x00510600, 0x00510802, 0x00510804,
+        0x00510808, 0x00510820, 0x00510880, 0x00510900, 0x00510a00, 0x00510c00, 0x00511002, 0x00511004,
+        0x00511008, 0x00511020, 0x00511080, 0x00511100, 0x00511200, 0x00511400, 0x00511800, 0x00512002,
+        0x00512004, 0x00512008, 0x00512020, 0x00512080, 0x00512100, 0x00512200, 0x00512400, 0x00512800,
+        0x00513000, 0x00514002, 0x00514004, 0x00514008, 0x00514020, 0x00514080, 0x00514100, 0x00514200,
+        0x00514400, 0x00514800, 0x00515000, 0x00516000, 0x00518002, 0x00518004, 0x00518008, 0x00518020,
+        0x00518080, 0x00518100, 0x00518200, 0x00518400, 0x00518800, 0x00519000, 0x0051a000, 0x0051c000,
+        0x00520005, 0x00520009, 0x0052000c, 0x00520021, 0x00520024, 0x00520028, 0x00520081, 0x00520084,
+        0x00520088, 0x005200a0, 0x00520101, 0x00520104, 0x00520108, 0x00520120, 0x00520180, 0x00520201,
+        0x00520204, 0x00520208, 0x00520220, 0x00520280, 0x00520300, 0x00520401, 0x00520404, 0x00520408,
+        0x00520420, 0x00520480, 0x00520500, 0x00520600, 0x00520801, 0x00520804, 0x00520808, 0x00520820,
+        0x00520880, 0x00520900, 0x00520a00, 0x00520c00, 0x00521001, 0x00521004, 0x00521008, 0x00521020,
+        0x00521080, 0x00521100, 0x00521200, 0x00521400, 0x00521800, 0x00522001, 0x00522004, 0x00522008,
+        0x00522020, 0x00522080, 0x00522100, 0x00522200, 0x00522400, 0x00522800, 0x00523000, 0x00524001,
+        0x00524004, 0x00524008, 0x00524020, 0x00524080, 0x00524100, 0x00524200, 0x00524400, 0x00524800,
+        0x00525000, 0x00526000, 0x00528001, 0x00528004, 0x00528008, 0x00528020, 0x00528080, 0x00528100,
+        0x00528200, 0x00528400, 0x00528800, 0x00529000, 0x0052a000, 0x0052c000, 0x00540003, 0x00540009,
+        0x0054000a, 0x00540021, 0x00540022, 0x00540028, 0x00540081, 0x00540082, 0x00540088, 0x005400a0,
+        0x00540101, 0x00540102, 0x00540108, 0x00540120, 0x00540180, 0x00540201, 0x00540202, 0x00540208,
+        0x00540220, 0x00540280, 0x00540300, 0x00540401, 0x00540402, 0x00540408, 0x00540420, 0x00540480,
+        0x00540500, 0x00540600, 0x00540801, 0x00540802, 0x00540808, 0x00540820, 0x00540880, 0x00540900,
+        0x00540a00, 0x00540c00, 0x00541001, 0x00541002, 0x00541008, 0x00541020, 0x00541080, 0x00541100,
+        0x00541200, 0x00541400, 0x00541800, 0x00542001, 0x00542002, 0x00542008, 0x00542020, 0x00542080,
+        0x00542100, 0x00542200, 0x00542400, 0x00542800, 0x00543000, 0x00544001, 0x00544002, 0x00544008,
+        0x00544020, 0x00544080, 0x00544100, 0x00544200, 0x00544400, 0x00544800, 0x00545000, 0x00546000,
+        0x00548001, 0x00548002, 0x00548008, 0x00548020, 0x00548080, 0x00548100, 0x00548200, 0x00548400,
+        0x00548800, 0x00549000, 0x0054a000, 0x0054c000, 0x00580003, 0x00580005, 0x00580006, 0x00580021,
+        0x00580022, 0x00580024, 0x00580081, 0x00580082, 0x00580084, 0x005800a0, 0x00580101, 0x00580102,
+        0x00580104, 0x00580120, 0x00580180, 0x00580201, 0x00580202, 0x00580204, 0x00580220, 0x00580280,
+        0x00580300, 0x00580401, 0x00580402, 0x00580404, 0x00580420, 0x00580480, 0x00580500, 0x00580600,
+        0x00580801, 0x00580802, 0x00580804, 0x00580820, 0x00580880, 0x00580900, 0x00580a00, 0x00580c00,
+        0x00581001, 0x00581002, 0x00581004, 0x00581020, 0x00581080, 0x00581100, 0x00581200, 0x00581400,
+        0x00581800, 0x00582001, 0x00582002, 0x00582004, 0x00582020, 0x00582080, 0x00582100, 0x00582200,
+        0x00582400, 0x00582800, 0x00583000, 0x00584001, 0x00584002, 0x00584004, 0x00584020, 0x00584080,
+        0x00584100, 0x00584200, 0x00584400, 0x00584800, 0x00585000, 0x00586000, 0x00588001, 0x00588002,
+        0x00588004, 0x00588020, 0x00588080, 0x00588100, 0x00588200, 0x00588400, 0x00588800, 0x00589000,
+        0x0058a000, 0x0058c000, 0x00600001, 0x00600002, 0x00600003, 0x00600005, 0x00600006, 0x00600009,
+        0x00600010, 0x00600011, 0x00600012, 0x00600014, 0x00600018, 0x00600090, 0x00600100, 0x00600101,
+        0x00600102, 0x00600104, 0x00600108, 0x00600110, 0x00600180, 0x00600200, 0x00600201, 0x00600202,
+        0x00600204, 0x00600208, 0x00600210, 0x00600280, 0x00600300, 0x00600500, 0x00600600, 0x00600900,
+        0x00601000, 0x00601001, 0x00601002, 0x00601004, 0x00601008, 0x00601010, 0x00601080, 0x00601100,
+        0x00601200, 0x00601400, 0x00601800, 0x00602000, 0x00602001, 0x00602002, 0x00602004, 0x00602008,
+        0x00602010, 0x00602080, 0x00602100, 0x00602200, 0x00602400, 0x00602800, 0x00603000, 0x00605000,
+        0x00606000, 0x00609000, 0x00610006, 0x0061000a, 0x0061000c, 0x00610012, 0x00610014, 0x00610018,
+        0x00610082, 0x00610084, 0x00610088, 0x00610090, 0x00610102, 0x00610104, 0x00610108, 0x00610110,
+        0x00610180, 0x00610202, 0x00610204, 0x00610208, 0x00610210, 0x00610280, 0x00610300, 0x00610402,
+        0x00610404, 0x00610408, 0x00610410, 0x00610480, 0x00610500, 0x00610600, 0x00610802, 0x00610804,
+        0x00610808, 0x00610810, 0x00610880, 0x00610900, 0x00610a00, 0x00610c00, 0x00611002, 0x00611004,
+        0x00611008, 0x00611010, 0x00611080, 0x00611100, 0x00611200, 0x00611400, 0x00611800, 0x00612002,
+        0x00612004, 0x00612008, 0x00612010, 0x00612080, 0x00612100, 0x00612200, 0x00612400, 0x00612800,
+        0x00613000, 0x00614002, 0x00614004, 0x00614008, 0x00614010, 0x00614080, 0x00614100, 0x00614200,
+        0x00614400, 0x00614800, 0x00615000, 0x00616000, 0x00618002, 0x00618004, 0x00618008, 0x00618010,
+        0x00618080, 0x00618100, 0x00618200, 0x00618400, 0x00618800, 0x00619000, 0x0061a000, 0x0061c000,
+        0x00620005, 0x00620009, 0x0062000c, 0x00620011, 0x00620014, 0x00620018, 0x00620081, 0x00620084,
+        0x00620088, 0x00620090, 0x00620101, 0x00620104, 0x00620108, 0x00620110, 0x00620180, 0x00620201,
+        0x00620204, 0x00620208, 0x00620210, 0x00620280, 0x00620300, 0x00620401, 0x00620404, 0x00620408,
+        0x00620410, 0x00620480, 0x00620500, 0x00620600, 0x00620801, 0x00620804, 0x00620808, 0x00620810,
+        0x00620880, 0x00620900, 0x00620a00, 0x00620c00, 0x00621001, 0x00621004, 0x00621008, 0x00621010,
+        0x00621080, 0x00621100, 0x00621200, 0x00621400, 0x00621800, 0x00622001, 0x00622004, 0x00622008,
+        0x00622010, 0x00622080, 0x00622100, 0x00622200, 0x00622400, 0x00622800, 0x00623000, 0x00624001,
+        0x00624004, 0x00624008, 0x00624010, 0x00624080, 0x00624100, 0x00624200, 0x00624400, 0x00624800,
+        0x00625000, 0x00626000, 0x00628001, 0x00628004, 0x00628008, 0x00628010, 0x00628080, 0x00628100,
+        0x00628200, 0x00628400, 0x00628800, 0x00629000, 0x0062a000, 0x0062c000, 0x00700003, 0x00700005,
+        0x00700006, 0x00700009, 0x0070000a, 0x0070000c, 0x00700081, 0x00700082, 0x00700084, 0x00700088,
+        0x00700101, 0x00700102, 0x00700104, 0x00700108, 0x00700180, 0x00700201, 0x00700202, 0x00700204,
+        0x00700208, 0x00700280, 0x00700300, 0x00700401, 0x00700402, 0x00700404, 0x00700408, 0x00700480,
+        0x00700500, 0x00700600, 0x00700801, 0x00700802, 0x00700804, 0x00700808, 0x00700880, 0x00700900,
+        0x00700a00, 0x00700c00, 0x00701001, 0x00701002, 0x00701004, 0x00701008, 0x00701080, 0x00701100,
+        0x00701200, 0x00701400, 0x00701800, 0x00702001, 0x00702002, 0x00702004, 0x00702008, 0x00702080,
+        0x00702100, 0x00702200, 0x00702400, 0x00702800, 0x00703000, 0x00704001, 0x00704002, 0x00704004,
+        0x00704008, 0x00704080, 0x00704100, 0x00704200, 0x00704400, 0x00704800, 0x00705000, 0x00706000,
+        0x00708001, 0x00708002, 0x00708004, 0x00708008, 0x00708080, 0x00708100, 0x00708200, 0x00708400,
+        0x00708800, 0x00709000, 0x0070a000, 0x0070c000, 0x00900001, 0x00900002, 0x00900003, 0x00900005,
+        0x00900006, 0x00900009, 0x00900020, 0x00900021, 0x00900022, 0x00900024, 0x00900028, 0x00900060,
+        0x00900100, 0x00900101, 0x00900102, 0x00900104, 0x00900108, 0x00900120, 0x00900140, 0x00900200,
+        0x00900201, 0x00900202, 0x00900204, 0x00900208, 0x00900220, 0x00900240, 0x00900300, 0x00900500,
+        0x00900600, 0x00900900, 0x00901000, 0x00901001, 0x00901002, 0x00901004, 0x00901008, 0x00901020,
+        0x00901040, 0x00901100, 0x00901200, 0x00901400, 0x00901800, 0x00902000, 0x00902001, 0x00902002,
+        0x00902004, 0x00902008, 0x00902020, 0x00902040, 0x00902100, 0x00902200, 0x00902400, 0x00902800,
+        0x00903000, 0x00905000, 0x00906000, 0x00909000, 0x00910006, 0x0091000a, 0x0091000c, 0x00910022,
+        0x00910024, 0x00910028, 0x00910042, 0x00910044, 0x00910048, 0x00910060, 0x00910102, 0x00910104,
+        0x00910108, 0x00910120, 0x00910140, 0x00910202, 0x00910204, 0x00910208, 0x00910220, 0x00910240,
+        0x00910300, 0x00910402, 0x00910404, 0x00910408, 0x00910420, 0x00910440, 0x00910500, 0x00910600,
+        0x00910802, 0x00910804, 0x00910808, 0x00910820, 0x00910840, 0x00910900, 0x00910a00, 0x00910c00,
+        0x00911002, 0x00911004, 0x00911008, 0x00911020, 0x00911040, 0x00911100, 0x00911200, 0x00911400,
+        0x00911800, 0x00912002, 0x00912004, 0x00912008, 0x00912020, 0x00912040, 0x00912100, 0x00912200,
+        0x00912400, 0x00912800, 0x00913000, 0x00914002, 0x00914004, 0x00914008, 0x00914020, 0x00914040,
+        0x00914100, 0x00914200, 0x00914400, 0x00914800, 0x00915000, 0x00916000, 0x00918002, 0x00918004,
+        0x00918008, 0x00918020, 0x00918040, 0x00918100, 0x00918200, 0x00918400, 0x00918800, 0x00919000,
+        0x0091a000, 0x0091c000, 0x00920005, 0x00920009, 0x0092000c, 0x00920021, 0x00920024, 0x00920028,
+        0x00920041, 0x00920044, 0x00920048, 0x00920060, 0x00920101, 0x00920104, 0x00920108, 0x00920120,
+        0x00920140, 0x00920201, 0x00920204, 0x00920208, 0x00920220, 0x00920240, 0x00920300, 0x00920401,
+        0x00920404, 0x00920408, 0x00920420, 0x00920440, 0x00920500, 0x00920600, 0x00920801, 0x00920804,
+        0x00920808, 0x00920820, 0x00920840, 0x00920900, 0x00920a00, 0x00920c00, 0x00921001, 0x00921004,
+        0x00921008, 0x00921020, 0x00921040, 0x00921100, 0x00921200, 0x00921400, 0x00921800, 0x00922001,
+        0x00922004, 0x00922008, 0x00922020, 0x00922040, 0x00922100, 0x00922200, 0x00922400, 0x00922800,
+        0x00923000, 0x00924001, 0x00924004, 0x00924008, 0x00924020, 0x00924040, 0x00924100, 0x00924200,
+        0x00924400, 0x00924800, 0x00925000, 0x00926000, 0x00928001, 0x00928004, 0x00928008, 0x00928020,
+        0x00928040, 0x00928100, 0x00928200, 0x00928400, 0x00928800, 0x00929000, 0x0092a000, 0x0092c000,
+        0x00b00003, 0x00b00005, 0x00b00006, 0x00b00009, 0x00b0000a, 0x00b0000c, 0x00b00041, 0x00b00042,
+        0x00b00044, 0x00b00048, 0x00b00101, 0x00b00102, 0x00b00104, 0x00b00108, 0x00b00140, 0x00b00201,
+        0x00b00202, 0x00b00204, 0x00b00208, 0x00b00240, 0x00b00300, 0x00b00401, 0x00b00402, 0x00b00404,
+        0x00b00408, 0x00b00440, 0x00b00500, 0x00b00600, 0x00b00801, 0x00b00802, 0x00b00804, 0x00b00808,
+        0x00b00840, 0x00b00900, 0x00b00a00, 0x00b00c00, 0x00b01001, 0x00b01002, 0x00b01004, 0x00b01008,
+        0x00b01040, 0x00b01100, 0x00b01200, 0x00b01400, 0x00b01800, 0x00b02001, 0x00b02002, 0x00b02004,
+        0x00b02008, 0x00b02040, 0x00b02100, 0x00b02200, 0x00b02400, 0x00b02800, 0x00b03000, 0x00b04001,
+        0x00b04002, 0x00b04004, 0x00b04008, 0x00b04040, 0x00b04100, 0x00b04200, 0x00b04400, 0x00b04800,
+        0x00b05000, 0x00b06000, 0x00b08001, 0x00b08002, 0x00b08004, 0x00b08008, 0x00b08040, 0x00b08100,
+        0x00b08200, 0x00b08400, 0x00b08800, 0x00b09000, 0x00b0a000, 0x00b0c000, 0x01040001, 0x01040002,
+        0x01040003, 0x01040008, 0x01040009, 0x0104000a, 0x01040012, 0x01040018, 0x01040020, 0x01040021,
+        0x01040022, 0x01040028, 0x01040040, 0x01040041, 0x01040042, 0x01040048, 0x01040050, 0x01040060,
+        0x01040080, 0x01040081, 0x01040082, 0x01040088, 0x01040090, 0x010400a0, 0x010400c0, 0x01040208,
+        0x01040240, 0x01040280, 0x01040400, 0x01040401, 0x01040402, 0x01040408, 0x01040420, 0x01040440,
+        0x01040480, 0x01040800, 0x01040801, 0x01040802, 0x01040808, 0x01040810, 0x01040820, 0x01040840,
+        0x01040880, 0x01040a00, 0x01040c00, 0x01041008, 0x01041080, 0x01041800, 0x01042080, 0x01042800,
+        0x01044800, 0x01048000, 0x01048001, 0x01048002, 0x01048008, 0x01048020, 0x01048040, 0x01048080,
+        0x01048400, 0x01048800, 0x0105000a, 0x01050012, 0x01050018, 0x01050022, 0x01050028, 0x01050042,
+        0x01050048, 0x01050050, 0x01050060, 0x01050082, 0x01050088, 0x01050090, 0x010500a0, 0x010500c0,
+        0x01050208, 0x01050240, 0x01050280, 0x01050402, 0x01050408, 0x01050420, 0x01050440, 0x01050480,
+        0x01050802, 0x01050808, 0x01050810, 0x01050820, 0x01050840, 0x01050880, 0x01050a00, 0x01050c00,
+        0x01051008, 0x01051080, 0x01051800, 0x01052080, 0x01052800, 0x01054800, 0x01058002, 0x01058008,
+        0x01058020, 0x01058040, 0x01058080, 0x01058400, 0x01058800, 0x01060009, 0x01060011, 0x01060018,
+        0x01060021, 0x01060028, 0x01060030, 0x01060041, 0x01060048, 0x01060050, 0x01060060, 0x01060081,
+        0x01060088, 0x01060090, 0x010600a0, 0x010600c0, 0x01060201, 0x01060208, 0x01060210, 0x01060220,
+        0x01060240, 0x01060280, 0x01060401, 0x01060408, 0x01060410, 0x01060420, 0x01060440, 0x01060480,
+        0x01060600, 0x01060801, 0x01060808, 0x01060810, 0x01060820, 0x01060840, 0x01060880, 0x01060a00,
+        0x01060c00, 0x01061001, 0x01061008, 0x01061010, 0x01061020, 0x01061040, 0x01061080, 0x01061200,
+        0x01061400, 0x01061800, 0x01062001, 0x01062008, 0x01062010, 0x01062020, 0x01062040, 0x01062080,
+        0x01062200, 0x01062400, 0x01062800, 0x01063000, 0x01064001, 0x01064008, 0x01064010, 0x01064020,
+        0x01064040, 0x01064080, 0x01064200, 0x01064400, 0x01064800, 0x01065000, 0x01066000, 0x01068001,
+        0x01068008, 0x01068010, 0x01068020, 0x01068040, 0x01068080, 0x01068200, 0x01068400, 0x01068800,
+        0x01069000, 0x0106a000, 0x0106c000, 0x01080001, 0x01080002, 0x01080003, 0x01080004, 0x01080005,
+        0x01080006, 0x01080010, 0x01080011, 0x01080012, 0x01080014, 0x01080020, 0x01080021, 0x01080022,
+        0x01080024, 0x01080030, 0x01080040, 0x01080041, 0x01080042, 0x01080044, 0x01080050, 0x01080060,
+        0x01080080, 0x01080081, 0x01080082, 0x01080084, 0x01080090, 0x010800a0, 0x010800c0, 0x01080200,
+        0x01080201, 0x01080202, 0x01080204, 0x01080210, 0x01080220, 0x01080240, 0x01080280, 0x01080400,
+        0x01080401, 0x01080402, 0x01080404, 0x01080410, 0x01080420, 0x01080440, 0x01080480, 0x01080600,
+        0x01080800, 0x01080801, 0x01080802, 0x01080804, 0x01080810, 0x01080820, 0x01080840, 0x01080880,
+        0x01080a00, 0x01080c00, 0x01081000, 0x01081001, 0x01081002, 0x01081004, 0x01081010, 0x01081020,
+        0x01081040, 0x01081080, 0x01081200, 0x01081400, 0x01081800, 0x01082000, 0x01082001, 0x01082002,
+        0x01082004, 0x01082010, 0x01082020, 0x01082040, 0x01082080, 0x01082200, 0x01082400, 0x01082800,
+        0x01083000, 0x01084000, 0x01084001, 0x01084002, 0x01084004, 0x01084010, 0x01084020, 0x01084040,
+        0x01084080, 0x01084200, 0x01084400, 0x01084800, 0x01085000, 0x01086000, 0x01088000, 0x01088001,
+        0x01088002, 0x01088004, 0x01088010, 0x01088020, 0x01088040, 0x01088080, 0x01088200, 0x01088400,
+        0x01088800, 0x01089000, 0x0108a000, 0x0108c000, 0x01090006, 0x01090012, 0x01090014, 0x01090022,
+        0x01090024, 0x01090030, 0x01090042, 0x01090044, 0x01090050, 0x01090060, 0x01090082, 0x01090084,
+        0x01090090, 0x010900a0, 0x010900c0, 0x01090202, 0x01090204, 0x01090210, 0x01090220, 0x01090240,
+        0x01090280, 0x01090402, 0x01090404, 0x01090410, 0x01090420, 0x01090440, 0x01090480, 0x01090600,
+        0x01090802, 0x01090804, 0x01090810, 0x01090820, 0x01090840, 0x01090880, 0x01090a00, 0x01090c00,
+        0x01091002, 0x01091004, 0x01091010, 0x01091020, 0x01091040, 0x01091080, 0x01091200, 0x01091400,
+        0x01091800, 0x01092002, 0x01092004, 0x01092010, 0x01092020, 0x01092040, 0x01092080, 0x01092200,
+        0x01092400, 0x01092800, 0x01093000, 0x01094002, 0x01094004, 0x01094010, 0x01094020, 0x01094040,
+        0x01094080, 0x01094200, 0x01094400, 0x01094800, 0x01095000, 0x01096000, 0x01098002, 0x01098004,
+        0x01098010, 0x01098020, 0x01098040, 0x01098080, 0x01098200, 0x01098400, 0x01098800, 0x01099000,
+        0x0109a000, 0x0109c000, 0x010a0005, 0x010a0011, 0x010a0014, 0x010a0021, 0x010a0024, 0x010a0030,
+        0x010a0041, 0x010a0044, 0x010a0050, 0x010a0060, 0x010a0081, 0x010a0084, 0x010a0090, 0x010a00a0,
+        0x010a00c0, 0x010a0201, 0x010a0204, 0x010a0210, 0x010a0220, 0x010a0240, 0x010a0280, 0x010a0401,
+        0x010a0404, 0x010a0410, 0x010a0420, 0x010a0440, 0x010a0480, 0x010a0600, 0x010a0801, 0x010a0804,
+        0x010a0810, 0x010a0820, 0x010a0840, 0x010a0880, 0x010a0a00, 0x010a0c00, 0x010a1001, 0x010a1004,
+        0x010a1010, 0x010a1020, 0x010a1040, 0x010a1080, 0x010a1200, 0x010a1400, 0x010a1800, 0x010a2001,
+        0x010a2004, 0x010a2010, 0x010a2020, 0x010a2040, 0x010a2080, 0x010a2200, 0x010a2400, 0x010a2800,
+        0x010a3000, 0x010a4001, 0x010a4004, 0x010a4010, 0x010a4020, 0x010a4040, 0x010a4080, 0x010a4200,
+        0x010a4400, 0x010a4800, 0x010a5000, 0x010a6000, 0x010a8001, 0x010a8004, 0x010a8010, 0x010a8020,
+        0x010a8040, 0x010a8080, 0x010a8200, 0x010a8400, 0x010a8800, 0x010a9000, 0x010aa000, 0x010ac000,
+        0x010c0003, 0x010c0011, 0x010c0012, 0x010c0021, 0x010c0022, 0x010c0030, 0x010c0041, 0x010c0042,
+        0x010c0050, 0x010c0060, 0x010c0081, 0x010c0082, 0x010c0090, 0x010c00a0, 0x010c00c0, 0x010c0201,
+        0x010c0202, 0x010c0210, 0x010c0220, 0x010c0240, 0x010c0280, 0x010c0401, 0x010c0402, 0x010c0410,
+        0x010c0420, 0x010c0440, 0x010c0480, 0x010c0600, 0x010c0801, 0x010c0802, 0x010c0810, 0x010c0820,
+        0x010c0840, 0x010c0880, 0x010c0a00, 0x010c0c00, 0x010c1001, 0x010c1002, 0x010c1010, 0x010c1020,
+        0x010c1040, 0x010c1080, 0x010c1200, 0x010c1400, 0x010c1800, 0x010c2001, 0x010c2002, 0x010c2010,
+        0x010c2020, 0x010c2040, 0x010c2080, 0x010c2200, 0x010c2400, 0x010c2800, 0x010c3000, 0x010c4001,
+        0x010c4002, 0x010c4010, 0x010c4020, 0x010c4040, 0x010c4080, 0x010c4200, 0x010c4400, 0x010c4800,
+        0x010c5000, 0x010c6000, 0x010c8001, 0x010c8002, 0x010c8010, 0x010c8020, 0x010c8040, 0x010c8080,
+        0x010c8200, 0x010c8400, 0x010c8800, 0x010c9000, 0x010ca000, 0x010cc000, 0x01180003, 0x01180005,
+        0x01180006, 0x01180021, 0x01180022, 0x01180024, 0x01180041, 0x01180042, 0x01180044, 0x01180060,
+        0x01180081, 0x01180082, 0x01180084, 0x011800a0, 0x011800c0, 0x01180201, 0x01180202, 0x01180204,
+        0x01180220, 0x01180240, 0x01180280, 0x01180401, 0x01180402, 0x01180404, 0x01180420, 0x01180440,
+        0x01180480, 0x01180600, 0x01180801, 0x01180802, 0x01180804, 0x01180820, 0x01180840, 0x01180880,
+        0x01180a00, 0x01180c00, 0x01181001, 0x01181002, 0x01181004, 0x01181020, 0x01181040, 0x01181080,
+        0x01181200, 0x01181400, 0x01181800, 0x01182001, 0x01182002, 0x01182004, 0x01182020, 0x01182040,
+        0x01182080, 0x01182200, 0x01182400, 0x01182800, 0x01183000, 0x01184001, 0x01184002, 0x01184004,
+        0x01184020, 0x01184040, 0x01184080, 0x01184200, 0x01184400, 0x01184800, 0x01185000, 0x01186000,
+        0x01188001, 0x01188002, 0x01188004, 0x01188020, 0x01188040, 0x01188080, 0x01188200, 0x01188400,
+        0x01188800, 0x01189000, 0x0118a000, 0x0118c000, 0x01240003, 0x01240009, 0x0124000a, 0x01240012,
+        0x01240018, 0x01240041, 0x01240042, 0x01240048, 0x01240050, 0x01240081, 0x01240082, 0x01240088,
+        0x01240090, 0x012400c0, 0x01240208, 0x01240240, 0x01240280, 0x01240401, 0x01240402, 0x01240408,
+        0x01240440, 0x01240480, 0x01240801, 0x01240802, 0x01240808, 0x01240810, 0x01240840, 0x01240880,
+        0x01240a00, 0x01240c00, 0x01241008, 0x01241080, 0x01241800, 0x01242080, 0x01242800, 0x01244800,
+        0x01248001, 0x01248002, 0x01248008, 0x01248040, 0x01248080, 0x01248400, 0x01248800, 0x01280003,
+        0x01280005, 0x01280006, 0x01280011, 0x01280012, 0x01280014, 0x01280041, 0x01280042, 0x01280044,
+        0x01280050, 0x01280081, 0x01280082, 0x01280084, 0x01280090, 0x012800c0, 0x01280201, 0x01280202,
+        0x01280204, 0x01280210, 0x01280240, 0x01280280, 0x01280401, 0x01280402, 0x01280404, 0x01280410,
+        0x01280440, 0x01280480, 0x01280600, 0x01280801, 0x01280802, 0x01280804, 0x01280810, 0x01280840,
+        0x01280880, 0x01280a00, 0x01280c00, 0x01281001, 0x01281002, 0x01281004, 0x01281010, 0x01281040,
+        0x01281080, 0x01281200, 0x01281400, 0x01281800, 0x01282001, 0x01282002, 0x01282004, 0x01282010,
+        0x01282040, 0x01282080, 0x01282200, 0x01282400, 0x01282800, 0x01283000, 0x01284001, 0x01284002,
+        0x01284004, 0x01284010, 0x01284040, 0x01284080, 0x01284200, 0x01284400, 0x01284800, 0x01285000,
+        0x01286000, 0x01288001, 0x01288002, 0x01288004, 0x01288010, 0x01288040, 0x01288080, 0x01288200,
+        0x01288400, 0x01288800, 0x01289000, 0x0128a000, 0x0128c000, 0x01400001, 0x01400002, 0x01400003,
+        0x01400004, 0x01400005, 0x01400006, 0x01400008, 0x01400009, 0x0140000a, 0x0140000c, 0x01400010,
+        0x01400011, 0x01400012, 0x01400014, 0x01400018, 0x01400020, 0x01400021, 0x01400022, 0x01400024,
+        0x01400028, 0x01400030, 0x01400080, 0x01400081, 0x01400082, 0x01400084, 0x01400088, 0x01400090,
+        0x014000a0, 0x01400200, 0x01400201, 0x01400202, 0x01400204, 0x01400208, 0x01400210, 0x01400220,
+        0x01400280, 0x01400400, 0x01400401, 0x01400402, 0x01400404, 0x01400408, 0x01400410, 0x01400420,
+        0x01400480, 0x01400600, 0x01400800, 0x01400801, 0x01400802, 0x01400804, 0x01400808, 0x01400810,
+        0x01400820, 0x01400880, 0x01400a00, 0x01400c00, 0x01401000, 0x01401001, 0x01401002, 0x01401004,
+        0x01401008, 0x01401010, 0x01401020, 0x01401080, 0x01401200, 0x01401400, 0x01401800, 0x01402000,
+        0x01402001, 0x01402002, 0x01402004, 0x01402008, 0x01402010, 0x01402020, 0x01402080, 0x01402200,
+        0x01402400, 0x01402800, 0x01403000, 0x01404000, 0x01404001, 0x01404002, 0x01404004, 0x01404008,
+        0x01404010, 0x01404020, 0x01404080, 0x01404200, 0x01404400, 0x01404800, 0x01405000, 0x01406000,
+        0x01408000, 0x01408001, 0x01408002, 0x01408004, 0x01408008, 0x01408010, 0x01408020, 0x01408080,
+        0x01408200, 0x01408400, 0x01408800, 0x01409000, 0x0140a000, 0x0140c000, 0x01410006, 0x0141000a,
+        0x0141000c, 0x01410012, 0x01410014, 0x01410018, 0x01410022, 0x01410024, 0x01410028, 0x01410030,
+        0x01410082, 0x01410084, 0x01410088, 0x01410090, 0x014100a0, 0x01410202, 0x01410204, 0x01410208,
+        0x01410210, 0x01410220, 0x01410280, 0x01410402, 0x01410404, 0x01410408, 0x01410410, 0x01410420,
+        0x01410480, 0x01410600, 0x01410802, 0x01410804, 0x01410808, 0x01410810, 0x01410820, 0x01410880,
+        0x01410a00, 0x01410c00, 0x01411002, 0x01411004, 0x01411008, 0x01411010, 0x01411020, 0x01411080,
+        0x01411200, 0x01411400, 0x01411800, 0x01412002, 0x01412004, 0x01412008, 0x01412010, 0x01412020,
+        0x01412080, 0x01412200, 0x01412400, 0x01412800, 0x01413000, 0x01414002, 0x01414004, 0x01414008,
+        0x01414010, 0x01414020, 0x01414080, 0x01414200, 0x01414400, 0x01414800, 0x01415000, 0x01416000,
+        0x01418002, 0x01418004, 0x01418008, 0x01418010, 0x01418020, 0x01418080, 0x01418200, 0x01418400,
+        0x01418800, 0x01419000, 0x0141a000, 0x0141c000, 0x01420005, 0x01420009, 0x0142000c, 0x01420011,
+        0x01420014, 0x01420018, 0x01420021, 0x01420024, 0x01420028, 0x01420030, 0x01420081, 0x01420084,
+        0x01420088, 0x01420090, 0x014200a0, 0x01420201, 0x01420204, 0x01420208, 0x01420210, 0x01420220,
+        0x01420280, 0x01420401, 0x01420404, 0x01420408, 0x01420410, 0x01420420, 0x01420480, 0x01420600,
+        0x01420801, 0x01420804, 0x01420808, 0x01420810, 0x01420820, 0x01420880, 0x01420a00, 0x01420c00,
+        0x01421001, 0x01421004, 0x01421008, 0x01421010, 0x01421020, 0x01421080, 0x01421200, 0x01421400,
+        0x01421800, 0x01422001, 0x01422004, 0x01422008, 0x01422010, 0x01422020, 0x01422080, 0x01422200,
+        0x01422400, 0x01422800, 0x01423000, 0x01424001, 0x01424004, 0x01424008, 0x01424010, 0x01424020,
+        0x01424080, 0x01424200, 0x01424400, 0x01424800, 0x01425000, 0x01426000, 0x01428001, 0x01428004,
+        0x01428008, 0x01428010, 0x01428020, 0x01428080, 0x01428200, 0x01428400, 0x01428800, 0x01429000,
+        0x0142a000, 0x0142c000, 0x01440003, 0x01440009, 0x0144000a, 0x01440011, 0x01440012, 0x01440018,
+        0x01440021, 0x01440022, 0x01440028, 0x01440030, 0x01440081, 0x01440082, 0x01440088, 0x01440090,
+        0x014400a0, 0x01440201, 0x01440202, 0x01440208, 0x01440210, 0x01440220, 0x01440280, 0x01440401,
+        0x01440402, 0x01440408, 0x01440410, 0x01440420, 0x01440480, 0x01440600, 0x01440801, 0x01440802,
+        0x01440808, 0x01440810, 0x01440820, 0x01440880, 0x01440a00, 0x01440c00, 0x01441001, 0x01441002,
+        0x01441008, 0x01441010, 0x01441020, 0x01441080, 0x01441200, 0x01441400, 0x01441800, 0x01442001,
+        0x01442002, 0x01442008, 0x01442010, 0x01442020, 0x01442080, 0x01442200, 0x01442400, 0x01442800,
+        0x01443000, 0x01444001, 0x01444002, 0x01444008, 0x01444010, 0x01444020, 0x01444080, 0x01444200,
+        0x01444400, 0x01444800, 0x01445000, 0x01446000, 0x01448001, 0x01448002, 0x01448008, 0x01448010,
+        0x01448020, 0x01448080, 0x01448200, 0x01448400, 0x01448800, 0x01449000, 0x0144a000, 0x0144c000,
+        0x01480003, 0x01480005, 0x01480006, 0x01480011, 0x01480012, 0x01480014, 0x01480021, 0x01480022,
+        0x01480024, 0x01480030, 0x01480081, 0x01480082, 0x01480084, 0x01480090, 0x014800a0, 0x01480201,
+        0x01480202, 0x01480204, 0x01480210, 0x01480220, 0x01480280, 0x01480401, 0x01480402, 0x01480404,
+        0x01480410, 0x01480420, 0x01480480, 0x01480600, 0x01480801, 0x01480802, 0x01480804, 0x01480810,
+        0x01480820, 0x01480880, 0x01480a00, 0x01480c00, 0x01481001, 0x01481002, 0x01481004, 0x01481010,
+        0x01481020, 0x01481080, 0x01481200, 0x01481400, 0x01481800, 0x01482001, 0x01482002, 0x01482004,
+        0x01482010, 0x01482020, 0x01482080, 0x01482200, 0x01482400, 0x01482800, 0x01483000, 0x01484001,
+        0x01484002, 0x01484004, 0x01484010, 0x01484020, 0x01484080, 0x01484200, 0x01484400, 0x01484800,
+        0x01485000, 0x01486000, 0x01488001, 0x01488002, 0x01488004, 0x01488010, 0x01488020, 0x01488080,
+        0x01488200, 0x01488400, 0x01488800, 0x01489000, 0x0148a000, 0x0148c000, 0x01500003, 0x01500005,
+        0x01500006, 0x01500009, 0x0150000a, 0x0150000c, 0x01500021, 0x01500022, 0x01500024, 0x01500028,
+        0x01500081, 0x01500082, 0x01500084, 0x01500088, 0x015000a0, 0x01500201, 0x01500202, 0x01500204,
+        0x01500208, 0x01500220, 0x01500280, 0x01500401, 0x01500402, 0x01500404, 0x01500408, 0x01500420,
+        0x01500480, 0x01500600, 0x01500801, 0x01500802, 0x01500804, 0x01500808, 0x01500820, 0x01500880,
+        0x01500a00, 0x01500c00, 0x01501001, 0x01501002, 0x01501004, 0x01501008, 0x01501020, 0x01501080,
+        0x01501200, 0x01501400, 0x01501800, 0x01502001, 0x01502002, 0x01502004, 0x01502008, 0x01502020,
+        0x01502080, 0x01502200, 0x01502400, 0x01502800, 0x01503000, 0x01504001, 0x01504002, 0x01504004,
+        0x01504008, 0x01504020, 0x01504080, 0x01504200, 0x01504400, 0x01504800, 0x01505000, 0x01506000,
+        0x01508001, 0x01508002, 0x01508004, 0x01508008, 0x01508020, 0x01508080, 0x01508200, 0x01508400,
+        0x01508800, 0x01509000, 0x0150a000, 0x0150c000, 0x01600003, 0x01600005, 0x01600006, 0x01600009,
+        0x0160000a, 0x0160000c, 0x01600011, 0x01600012, 0x01600014, 0x01600018, 0x01600081, 0x01600082,
+        0x01600084, 0x01600088, 0x01600090, 0x01600201, 0x01600202, 0x01600204, 0x01600208, 0x01600210,
+        0x01600280, 0x01600401, 0x01600402, 0x01600404, 0x01600408, 0x01600410, 0x01600480, 0x01600600,
+        0x01600801, 0x01600802, 0x01600804, 0x01600808, 0x01600810, 0x01600880, 0x01600a00, 0x01600c00,
+        0x01601001, 0x01601002, 0x01601004, 0x01601008, 0x01601010, 0x01601080, 0x01601200, 0x01601400,
+        0x01601800, 0x01602001, 0x01602002, 0x01602004, 0x01602008, 0x01602010, 0x01602080, 0x01602200,
+        0x01602400, 0x01602800, 0x01603000, 0x01604001, 0x01604002, 0x01604004, 0x01604008, 0x01604010,
+        0x01604080, 0x01604200, 0x01604400, 0x01604800, 0x01605000, 0x01606000, 0x01608001, 0x01608002,
+        0x01608004, 0x01608008, 0x01608010, 0x01608080, 0x01608200, 0x01608400, 0x01608800, 0x01609000,
+        0x0160a000, 0x0160c000, 0x01800001, 0x01800002, 0x01800003, 0x01800004, 0x01800005, 0x01800006,
+        0x01800008, 0x01800009, 0x0180000a, 0x0180000c, 0x01800010, 0x01800011, 0x01800012, 0x01800014,
+        0x01800018, 0x01800020, 0x01800021, 0x01800022, 0x01800024, 0x01800028, 0x01800030, 0x01800040,
+        0x01800041, 0x01800042, 0x01800044, 0x01800048, 0x01800050, 0x01800060, 0x01800201, 0x01800202,
+        0x01800204, 0x01800208, 0x01800210, 0x01800220, 0x01800240, 0x01800401, 0x01800402, 0x01800404,
+        0x01800408, 0x01800410, 0x01800420, 0x01800801, 0x01800802, 0x01800804, 0x01800808, 0x01800810,
+        0x01801001, 0x01801002, 0x01801004, 0x01801008, 0x01802001, 0x01802002, 0x01802004, 0x01804001,
+        0x01804002, 0x01808001, 0x01810006, 0x0181000a, 0x0181000c, 0x01810012, 0x01810014, 0x01810018,
+        0x01810022, 0x01810024, 0x01810028, 0x01810030, 0x01810042, 0x01810044, 0x01810048, 0x01810050,
+        0x01810060, 0x01810202, 0x01810204, 0x01810208, 0x01810210, 0x01810220, 0x01810240, 0x01810402,
+        0x01810404, 0x01810408, 0x01810410, 0x01810420, 0x01810440, 0x01810600, 0x01810802, 0x01810804,
+        0x01810808, 0x01810810, 0x01810820, 0x01810840, 0x01810a00, 0x01810c00, 0x01811002, 0x01811004,
+        0x01811008, 0x01811010, 0x01811020, 0x01811040, 0x01811200, 0x01811400, 0x01811800, 0x01812002,
+        0x01812004, 0x01812008, 0x01812010, 0x01812020, 0x01812040, 0x01812200, 0x01812400, 0x01812800,
+        0x01813000, 0x01814002, 0x01814004, 0x01814008, 0x01814010, 0x01814020, 0x01814040, 0x01814200,
+        0x01814400, 0x01814800, 0x01815000, 0x01816000, 0x01818002, 0x01818004, 0x01818008, 0x01818010,
+        0x01818020, 0x01818040, 0x01818200, 0x01818400, 0x01818800, 0x01819000, 0x0181a000, 0x0181c000,
+        0x01820005, 0x01820009, 0x0182000c, 0x01820011, 0x01820014, 0x01820018, 0x01820021, 0x01820024,
+        0x01820028, 0x01820030, 0x01820041, 0x01820044, 0x01820048, 0x01820050, 0x01820060, 0x01820201,
+        0x01820204, 0x01820208, 0x01820210, 0x01820220, 0x01820240, 0x01820401, 0x01820404, 0x01820408,
+        0x01820410, 0x01820420, 0x01820440, 0x01820600, 0x01820801, 0x01820804, 0x01820808, 0x01820810,
+        0x01820820, 0x01820840, 0x01820a00, 0x01820c00, 0x01821001, 0x01821004, 0x01821008, 0x01821010,
+        0x01821020, 0x01821040, 0x01821200, 0x01821400, 0x01821800, 0x01822001, 0x01822004, 0x01822008,
+        0x01822010, 0x01822020, 0x01822040, 0x01822200, 0x01822400, 0x01822800, 0x01823000, 0x01824001,
+        0x01824004, 0x01824008, 0x01824010, 0x01824020, 0x01824040, 0x01824200, 0x01824400, 0x01824800,
+        0x01825000, 0x01826000, 0x01828001, 0x01828004, 0x01828008, 0x01828010, 0x01828020, 0x01828040,
+        0x01828200, 0x01828400, 0x01828800, 0x01829000, 0x0182a000, 0x0182c000, 0x01840003, 0x01840009,
+        0x0184000a, 0x01840011, 0x01840012, 0x01840018, 0x01840021, 0x01840022, 0x01840028, 0x01840030,
+        0x01840041, 0x01840042, 0x01840048, 0x01840050, 0x01840060, 0x01840201, 0x01840202, 0x01840208,
+        0x01840210, 0x01840220, 0x01840240, 0x01840401, 0x01840402, 0x01840408, 0x01840410, 0x01840420,
+        0x01840440, 0x01840600, 0x01840801, 0x01840802, 0x01840808, 0x01840810, 0x01840820, 0x01840840,
+        0x01840a00, 0x01840c00, 0x01841001, 0x01841002, 0x01841008, 0x01841010, 0x01841020, 0x01841040,
+        0x01841200, 0x01841400, 0x01841800, 0x01842001, 0x01842002, 0x01842008, 0x01842010, 0x01842020,
+        0x01842040, 0x01842200, 0x01842400, 0x01842800, 0x01843000, 0x01844001, 0x01844002, 0x01844008,
+        0x01844010, 0x01844020, 0x01844040, 0x01844200, 0x01844400, 0x01844800, 0x01845000, 0x01846000,
+        0x01848001, 0x01848002, 0x01848008, 0x01848010, 0x01848020, 0x01848040, 0x01848200, 0x01848400,
+        0x01848800, 0x01849000, 0x0184a000, 0x0184c000, 0x01880003, 0x01880005, 0x01880006, 0x01880011,
+        0x01880012, 0x01880014, 0x01880021, 0x01880022, 0x01880024, 0x01880030, 0x01880041, 0x01880042,
+        0x01880044, 0x01880050, 0x01880060, 0x01880201, 0x01880202, 0x01880204, 0x01880210, 0x01880220,
+        0x01880240, 0x01880401, 0x01880402, 0x01880404, 0x01880410, 0x01880420, 0x01880440, 0x01880600,
+        0x01880801, 0x01880802, 0x01880804, 0x01880810, 0x01880820, 0x01880840, 0x01880a00, 0x01880c00,
+        0x01881001, 0x01881002, 0x01881004, 0x01881010, 0x01881020, 0x01881040, 0x01881200, 0x01881400,
+        0x01881800, 0x01882001, 0x01882002, 0x01882004, 0x01882010, 0x01882020, 0x01882040, 0x01882200,
+        0x01882400, 0x01882800, 0x01883000, 0x01884001, 0x01884002, 0x01884004, 0x01884010, 0x01884020,
+        0x01884040, 0x01884200, 0x01884400, 0x01884800, 0x01885000, 0x01886000, 0x01888001, 0x01888002,
+        0x01888004, 0x01888010, 0x01888020, 0x01888040, 0x01888200, 0x01888400, 0x01888800, 0x01889000,
+        0x0188a000, 0x0188c000, 0x01900003, 0x01900005, 0x01900006, 0x01900009, 0x0190000a, 0x0190000c,
+        0x01900021, 0x01900022, 0x01900024, 0x01900028, 0x01900041, 0x01900042, 0x01900044, 0x01900048,
+        0x01900060, 0x01900201, 0x01900202, 0x01900204, 0x01900208, 0x01900220, 0x01900240, 0x01900401,
+        0x01900402, 0x01900404, 0x01900408, 0x01900420, 0x01900440, 0x01900600, 0x01900801, 0x01900802,
+        0x01900804, 0x01900808, 0x01900820, 0x01900840, 0x01900a00, 0x01900c00, 0x01901001, 0x01901002,
+        0x01901004, 0x01901008, 0x01901020, 0x01901040, 0x01901200, 0x01901400, 0x01901800, 0x01902001,
+        0x01902002, 0x01902004, 0x01902008, 0x01902020, 0x01902040, 0x01902200, 0x01902400, 0x01902800,
+        0x01903000, 0x01904001, 0x01904002, 0x01904004, 0x01904008, 0x01904020, 0x01904040, 0x01904200,
+        0x01904400, 0x01904800, 0x01905000, 0x01906000, 0x01908001, 0x01908002, 0x01908004, 0x01908008,
+        0x01908020, 0x01908040, 0x01908200, 0x01908400, 0x01908800, 0x01909000, 0x0190a000, 0x0190c000,
+        0x01a00003, 0x01a00005, 0x01a00006, 0x01a00009, 0x01a0000a, 0x01a0000c, 0x01a00011, 0x01a00012,
+        0x01a00014, 0x01a00018, 0x01a00041, 0x01a00042, 0x01a00044, 0x01a00048, 0x01a00050, 0x01a00201,
+        0x01a00202, 0x01a00204, 0x01a00208, 0x01a00210, 0x01a00240, 0x01a00401, 0x01a00402, 0x01a00404,
+        0x01a00408, 0x01a00410, 0x01a00440, 0x01a00600, 0x01a00801, 0x01a00802, 0x01a00804, 0x01a00808,
+        0x01a00810, 0x01a00840, 0x01a00a00, 0x01a00c00, 0x01a01001, 0x01a01002, 0x01a01004, 0x01a01008,
+        0x01a01010, 0x01a01040, 0x01a01200, 0x01a01400, 0x01a01800, 0x01a02001, 0x01a02002, 0x01a02004,
+        0x01a02008, 0x01a02010, 0x01a02040, 0x01a02200, 0x01a02400, 0x01a02800, 0x01a03000, 0x01a04001,
+        0x01a04002, 0x01a04004, 0x01a04008, 0x01a04010, 0x01a04040, 0x01a04200, 0x01a04400, 0x01a04800,
+        0x01a05000, 0x01a06000, 0x01a08001, 0x01a08002, 0x01a08004, 0x01a08008, 0x01a08010, 0x01a08040,
+        0x01a08200, 0x01a08400, 0x01a08800, 0x01a09000, 0x01a0a000, 0x01a0c000, 0x01c00003, 0x01c00005,
+        0x01c00006, 0x01c00009, 0x01c0000a, 0x01c0000c, 0x01c00011, 0x01c00012, 0x01c00014, 0x01c00018,
+        0x01c00021, 0x01c00022, 0x01c00024, 0x01c00028, 0x01c00030, 0x01c00201, 0x01c00202, 0x01c00204,
+        0x01c00208, 0x01c00210, 0x01c00220, 0x01c00401, 0x01c00402, 0x01c00404, 0x01c00408, 0x01c00410,
+        0x01c00420, 0x01c00600, 0x01c00801, 0x01c00802, 0x01c00804, 0x01c00808, 0x01c00810, 0x01c00820,
+        0x01c00a00, 0x01c00c00, 0x01c01001, 0x01c01002, 0x01c01004, 0x01c01008, 0x01c01010, 0x01c01020,
+        0x01c01200, 0x01c01400, 0x01c01800, 0x01c02001, 0x01c02002, 0x01c02004, 0x01c02008, 0x01c02010,
+        0x01c02020, 0x01c02200, 0x01c02400, 0x01c02800, 0x01c03000, 0x01c04001, 0x01c04002, 0x01c04004,
+        0x01c04008, 0x01c04010, 0x01c04020, 0x01c04200, 0x01c04400, 0x01c04800, 0x01c05000, 0x01c06000,
+        0x01c08001, 0x01c08002, 0x01c08004, 0x01c08008, 0x01c08010, 0x01c08020, 0x01c08200, 0x01c08400,
+        0x01c08800, 0x01c09000, 0x01c0a000, 0x01c0c000, 0x02080001, 0x02080002, 0x02080003, 0x02080004,
+        0x02080005, 0x02080006, 0x02080010, 0x02080011, 0x02080012, 0x02080014, 0x02080020, 0x02080021,
+        0x02080022, 0x02080024, 0x02080030, 0x02080040, 0x02080041, 0x02080042, 0x02080044, 0x02080050,
+        0x02080060, 0x02080081, 0x02080082, 0x02080084, 0x02080090, 0x020800a0, 0x02080100, 0x02080101,
+        0x02080102, 0x02080104, 0x02080110, 0x02080120, 0x02080140, 0x02080180, 0x02080401, 0x02080402,
+        0x02080410, 0x02080420, 0x02080500, 0x02080801, 0x02080802, 0x02080810, 0x02080900, 0x02081000,
+        0x02081001, 0x02081002, 0x02081004, 0x02081010, 0x02081020, 0x02081040, 0x02081100, 0x02082001,
+        0x02082010, 0x02082100, 0x02084001, 0x02084010, 0x02088001, 0x02090006, 0x02090012, 0x02090014,
+        0x02090022, 0x02090024, 0x02090030, 0x02090042, 0x02090044, 0x02090050, 0x02090060, 0x02090082,
+        0x02090084, 0x02090090, 0x020900a0, 0x020900c0, 0x02090102, 0x02090104, 0x02090110, 0x02090120,
+        0x02090140, 0x02090180, 0x02090402, 0x02090404, 0x02090410, 0x02090420, 0x02090440, 0x02090480,
+        0x02090500, 0x02090802, 0x02090804, 0x02090810, 0x02090820, 0x02090840, 0x02090880, 0x02090900,
+        0x02090c00, 0x02091002, 0x02091004, 0x02091010, 0x02091020, 0x02091040, 0x02091080, 0x02091100,
+        0x02091400, 0x02091800, 0x02092002, 0x02092004, 0x02092010, 0x02092020, 0x02092040, 0x02092080,
+        0x02092100, 0x02092400, 0x02092800, 0x02093000, 0x02094002, 0x02094004, 0x02094010, 0x02094020,
+        0x02094040, 0x02094080, 0x02094100, 0x02094400, 0x02094800, 0x02095000, 0x02096000, 0x02098002,
+        0x02098004, 0x02098010, 0x02098020, 0x02098040, 0x02098080, 0x02098100, 0x02098400, 0x02098800,
+        0x02099000, 0x0209a000, 0x0209c000, 0x020a0005, 0x020a0011, 0x020a0014, 0x020a0021, 0x020a0024,
+        0x020a0030, 0x020a0041, 0x020a0044, 0x020a0050, 0x020a0060, 0x020a0081, 0x020a0084, 0x020a0090,
+        0x020a00a0, 0x020a00c0, 0x020a0101, 0x020a0104, 0x020a0110, 0x020a0120, 0x020a0140, 0x020a0180,
+        0x020a0401, 0x020a0404, 0x020a0410, 0x020a0420, 0x020a0440, 0x020a0480, 0x020a0500, 0x020a0801,
+        0x020a0804, 0x020a0810, 0x020a0820, 0x020a0840, 0x020a0880, 0x020a0900, 0x020a0c00, 0x020a1001,
+        0x020a1004, 0x020a1010, 0x020a1020, 0x020a1040, 0x020a1080, 0x020a1100, 0x020a1400, 0x020a1800,
+        0x020a2001, 0x020a2004, 0x020a2010, 0x020a2020, 0x020a2040, 0x020a2080, 0x020a2100, 0x020a2400,
+        0x020a2800, 0x020a3000, 0x020a4001, 0x020a4004, 0x020a4010, 0x020a4020, 0x020a4040, 0x020a4080,
+        0x020a4100, 0x020a4400, 0x020a4800, 0x020a5000, 0x020a6000, 0x020a8001, 0x020a8004, 0x020a8010,
+        0x020a8020, 0x020a8040, 0x020a8080, 0x020a8100, 0x020a8400, 0x020a8800, 0x020a9000, 0x020aa000,
+        0x020ac000, 0x020c0003, 0x020c0011, 0x020c0012, 0x020c0021, 0x020c0022, 0x020c0030, 0x020c0041,
+        0x020c0042, 0x020c0050, 0x020c0060, 0x020c0081, 0x020c0082, 0x020c0090, 0x020c00a0, 0x020c00c0,
+        0x020c0101, 0x020c0102, 0x020c0110, 0x020c0120, 0x020c0140, 0x020c0180, 0x020c0401, 0x020c0402,
+        0x020c0410, 0x020c0420, 0x020c0440, 0x020c0480, 0x020c0500, 0x020c0801, 0x020c0802, 0x020c0810,
+        0x020c0820, 0x020c0840, 0x020c0880, 0x020c0900, 0x020c0c00, 0x020c1001, 0x020c1002, 0x020c1010,
+        0x020c1020, 0x020c1040, 0x020c1080, 0x020c1100, 0x020c1400, 0x020c1800, 0x020c2001, 0x020c2002,
+        0x020c2010, 0x020c2020, 0x020c2040, 0x020c2080, 0x020c2100, 0x020c2400, 0x020c2800, 0x020c3000,
+        0x020c4001, 0x020c4002, 0x020c4010, 0x020c4020, 0x020c4040, 0x020c4080, 0x020c4100, 0x020c4400,
+        0x020c4800, 0x020c5000, 0x020c6000, 0x020c8001, 0x020c8002, 0x020c8010, 0x020c8020, 0x020c8040,
+        0x020c8080, 0x020c8100, 0x020c8400, 0x020c8800, 0x020c9000, 0x020ca000, 0x020cc000, 0x02180003,
+        0x02180005, 0x02180006, 0x02180021, 0x02180022, 0x02180024, 0x02180041, 0x02180042, 0x02180044,
+        0x02180060, 0x02180081, 0x02180082, 0x02180084, 0x021800a0, 0x021800c0, 0x02180101, 0x02180102,
+        0x02180104, 0x02180120, 0x02180140, 0x02180180, 0x02180401, 0x02180402, 0x02180404, 0x02180420,
+        0x02180440, 0x02180480, 0x02180500, 0x02180801, 0x02180802, 0x02180804, 0x02180820, 0x02180840,
+        0x02180880, 0x02180900, 0x02180c00, 0x02181001, 0x02181002, 0x02181004, 0x02181020, 0x02181040,
+        0x02181080, 0x02181100, 0x02181400, 0x02181800, 0x02182001, 0x02182002, 0x02182004, 0x02182020,
+        0x02182040, 0x02182080, 0x02182100, 0x02182400, 0x02182800, 0x02183000, 0x02184001, 0x02184002,
+        0x02184004, 0x02184020, 0x02184040, 0x02184080, 0x02184100, 0x02184400, 0x02184800, 0x02185000,
+        0x02186000, 0x02188001, 0x02188002, 0x02188004, 0x02188020, 0x02188040, 0x02188080, 0x02188100,
+        0x02188400, 0x02188800, 0x02189000, 0x0218a000, 0x0218c000, 0x02280003, 0x02280005, 0x02280006,
+        0x02280011, 0x02280012, 0x02280014, 0x02280041, 0x02280042, 0x02280044, 0x02280050, 0x02280081,
+        0x02280082, 0x02280084, 0x02280090, 0x022800c0, 0x02280101, 0x02280102, 0x02280104, 0x02280110,
+        0x02280140, 0x02280180, 0x02280401, 0x02280402, 0x02280404, 0x02280410, 0x02280440, 0x02280480,
+        0x02280500, 0x02280801, 0x02280802, 0x02280804, 0x02280810, 0x02280840, 0x02280880, 0x02280900,
+        0x02280c00, 0x02281001, 0x02281002, 0x02281004, 0x02281010, 0x02281040, 0x02281080, 0x02281100,
+        0x02281400, 0x02281800, 0x02282001, 0x02282002, 0x02282004, 0x02282010, 0x02282040, 0x02282080,
+        0x02282100, 0x02282400, 0x02282800, 0x02283000, 0x02284001, 0x02284002, 0x02284004, 0x02284010,
+        0x02284040, 0x02284080, 0x02284100, 0x02284400, 0x02284800, 0x02285000, 0x02286000, 0x02288001,
+        0x02288002, 0x02288004, 0x02288010, 0x02288040, 0x02288080, 0x02288100, 0x02288400, 0x02288800,
+        0x02289000, 0x0228a000, 0x0228c000, 0x02400001, 0x02400002, 0x02400003, 0x02400004, 0x02400005,
+        0x02400006, 0x02400008, 0x02400009, 0x0240000a, 0x0240000c, 0x02400012, 0x02400014, 0x02400018,
+        0x02400020, 0x02400021, 0x02400022, 0x02400024, 0x02400028, 0x02400081, 0x02400082, 0x02400084,
+        0x02400090, 0x024000a0, 0x02400104, 0x02400108, 0x02400180, 0x02400401, 0x02400402, 0x02400420,
+        0x02400801, 0x02400802, 0x02400810, 0x02401008, 0x02408001, 0x02410006, 0x0241000a, 0x0241000c,
+        0x02410012, 0x02410014, 0x02410018, 0x02410022, 0x02410024, 0x02410028, 0x02410082, 0x02410084,
+        0x02410088, 0x02410090, 0x024100a0, 0x02410104, 0x02410108, 0x02410180, 0x02410402, 0x02410404,
+        0x02410408, 0x02410420, 0x02410480, 0x02410802, 0x02410804, 0x02410808, 0x02410810, 0x02410820,
+        0x02410880, 0x02410900, 0x02410c00, 0x02411008, 0x02411080, 0x02411800, 0x02412080, 0x02412800,
+        0x02414800, 0x02418002, 0x02418004, 0x02418008, 0x02418020, 0x02418080, 0x02418400, 0x02418800,
+        0x02420005, 0x02420009, 0x0242000c, 0x02420011, 0x02420014, 0x02420018, 0x02420021, 0x02420024,
+        0x02420028, 0x02420030, 0x02420081, 0x02420084, 0x02420088, 0x02420090, 0x024200a0, 0x02420101,
+        0x02420104, 0x02420108, 0x02420110, 0x02420120, 0x02420180, 0x02420401, 0x02420404, 0x02420408,
+        0x02420410, 0x02420420, 0x02420480, 0x02420500, 0x02420801, 0x02420804, 0x02420808, 0x02420810,
+        0x02420820, 0x02420880, 0x02420900, 0x02420c00, 0x02421001, 0x02421004, 0x02421008, 0x02421010,
+        0x02421020, 0x02421080, 0x02421100, 0x02421400, 0x02421800, 0x02422001, 0x02422004, 0x02422008,
+        0x02422010, 0x02422020, 0x02422080, 0x02422100, 0x02422400, 0x02422800, 0x02423000, 0x02424001,
+        0x02424004, 0x02424008, 0x02424010, 0x02424020, 0x02424080, 0x02424100, 0x02424400, 0x02424800,
+        0x02425000, 0x02426000, 0x02428001, 0x02428004, 0x02428008, 0x02428010, 0x02428020, 0x02428080,
+        0x02428100, 0x02428400, 0x02428800, 0x02429000, 0x0242a000, 0x0242c000, 0x02440003, 0x02440009,
+        0x0244000a, 0x02440011, 0x02440012, 0x02440018, 0x02440021, 0x02440022, 0x02440028, 0x02440030,
+        0x02440081, 0x02440082, 0x02440088, 0x02440090, 0x024400a0, 0x02440101, 0x02440102, 0x02440108,
+        0x02440110, 0x02440120, 0x02440180, 0x02440401, 0x02440402, 0x02440408, 0x02440410, 0x02440420,
+        0x02440480, 0x02440500, 0x02440801, 0x02440802, 0x02440808, 0x02440810, 0x02440820, 0x02440880,
+        0x02440900, 0x02440c00, 0x02441001, 0x02441002, 0x02441008, 0x02441010, 0x02441020, 0x02441080,
+        0x02441100, 0x02441400, 0x02441800, 0x02442001, 0x02442002, 0x02442008, 0x02442010, 0x02442020,
+        0x02442080, 0x02442100, 0x02442400, 0x02442800, 0x02443000, 0x02444001, 0x02444002, 0x02444008,
+        0x02444010, 0x02444020, 0x02444080, 0x02444100, 0x02444400, 0x02444800, 0x02445000, 0x02446000,
+        0x02448001, 0x02448002, 0x02448008, 0x02448010, 0x02448020, 0x02448080, 0x02448100, 0x02448400,
+        0x02448800, 0x02449000, 0x0244a000, 0x0244c000, 0x02480003, 0x02480005, 0x02480006, 0x02480011,
+        0x02480012, 0x02480014, 0x02480021, 0x02480022, 0x02480024, 0x02480030, 0x02480081, 0x02480082,
+        0x02480084, 0x02480090, 0x024800a0, 0x02480101, 0x02480102, 0x02480104, 0x02480110, 0x02480120,
+        0x02480180, 0x02480401, 0x02480402, 0x02480410, 0x02480420, 0x02480500, 0x02480801, 0x02480802,
+        0x02480810, 0x02480900, 0x02481001, 0x02481002, 0x02481004, 0x02481010, 0x02481020, 0x02481100,
+        0x02482001, 0x02482010, 0x02482100, 0x02484001, 0x02484010, 0x02488001, 0x02600003, 0x02600005,
+        0x02600006, 0x02600009, 0x0260000a, 0x0260000c, 0x02600012, 0x02600014, 0x02600018, 0x02600081,
+        0x02600082, 0x02600084, 0x02600088, 0x02600090, 0x02600104, 0x02600108, 0x02600180, 0x02600401,
+        0x02600402, 0x02600404, 0x02600408, 0x02600480, 0x02600801, 0x02600802, 0x02600804, 0x02600808,
+        0x02600810, 0x02600880, 0x02600900, 0x02600c00, 0x02601008, 0x02601080, 0x02601800, 0x02602080,
+        0x02602800, 0x02604800, 0x02608001, 0x02608002, 0x02608004, 0x02608008, 0x02608080, 0x02608400,
+        0x02608800, 0x02810006, 0x0281000a, 0x0281000c, 0x02810012, 0x02810014, 0x02810018, 0x02810022,
+        0x02810024, 0x02810028, 0x02810030, 0x02810042, 0x02810044, 0x02810048, 0x02810050, 0x02810060,
+        0x02810102, 0x02810104, 0x02810108, 0x02810110, 0x02810120, 0x02810140, 0x02810402, 0x02810404,
+        0x02810408, 0x02810410, 0x02810420, 0x02810440, 0x02810500, 0x02810802, 0x02810804, 0x02810808,
+        0x02810810, 0x02810820, 0x02810840, 0x02810900, 0x02810c00, 0x02811002, 0x02811004, 0x02811008,
+        0x02811010, 0x02811020, 0x02811040, 0x02811100, 0x02811400, 0x02811800, 0x02812002, 0x02812004,
+        0x02812008, 0x02812010, 0x02812020, 0x02812040, 0x02812100, 0x02812400, 0x02812800, 0x02813000,
+        0x02814002, 0x02814004, 0x02814008, 0x02814010, 0x02814020, 0x02814040, 0x02814100, 0x02814400,
+        0x02814800, 0x02815000, 0x02816000, 0x02818002, 0x02818004, 0x02818008, 0x02818010, 0x02818020,
+        0x02818040, 0x02818100, 0x02818400, 0x02818800, 0x02819000, 0x0281a000, 0x0281c000, 0x02820005,
+        0x02820009, 0x0282000c, 0x02820011, 0x02820014, 0x02820018, 0x02820021, 0x02820024, 0x02820028,
+        0x02820030, 0x02820041, 0x02820044, 0x02820048, 0x02820050, 0x02820060, 0x02820101, 0x02820104,
+        0x02820108, 0x02820110, 0x02820120, 0x02820140, 0x02820401, 0x02820404, 0x02820408, 0x02820410,
+        0x02820420, 0x02820440, 0x02820500, 0x02820801, 0x02820804, 0x02820808, 0x02820810, 0x02820820,
+        0x02820840, 0x02820900, 0x02820c00, 0x02821001, 0x02821004, 0x02821008, 0x02821010, 0x02821020,
+        0x02821040, 0x02821100, 0x02821400, 0x02821800, 0x02822001, 0x02822004, 0x02822008, 0x02822010,
+        0x02822020, 0x02822040, 0x02822100, 0x02822400, 0x02822800, 0x02823000, 0x02824001, 0x02824004,
+        0x02824008, 0x02824010, 0x02824020, 0x02824040, 0x02824100, 0x02824400, 0x02824800, 0x02825000,
+        0x02826000, 0x02828001, 0x02828004, 0x02828008, 0x02828010, 0x02828020, 0x02828040, 0x02828100,
+        0x02828400, 0x02828800, 0x02829000, 0x0282a000, 0x0282c000, 0x02840003, 0x02840009, 0x0284000a,
+        0x02840011, 0x02840012, 0x02840018, 0x02840021, 0x02840022, 0x02840028, 0x02840030, 0x02840041,
+        0x02840042, 0x02840048, 0x02840050, 0x02840060, 0x02840101, 0x02840102, 0x02840108, 0x02840110,
+        0x02840120, 0x02840140, 0x02840401, 0x02840402, 0x02840410, 0x02840420, 0x02840500, 0x02840801,
+        0x02840802, 0x02840810, 0x02840900, 0x02841001, 0x02841002, 0x02841008, 0x02841010, 0x02841020,
+        0x02841040, 0x02841100, 0x02842001, 0x02842010, 0x02842100, 0x02844001, 0x02844010, 0x02848001,
+        0x02900003, 0x02900005, 0x02900006, 0x02900009, 0x0290000a, 0x0290000c, 0x02900021, 0x02900022,
+        0x02900024, 0x02900028, 0x02900041, 0x02900042, 0x02900044, 0x02900048, 0x02900060, 0x02900101,
+        0x02900102, 0x02900104, 0x02900108, 0x02900120, 0x02900140, 0x02900401, 0x02900402, 0x02900404,
+        0x02900408, 0x02900420, 0x02900440, 0x02900500, 0x02900801, 0x02900802, 0x02900804, 0x02900808,
+        0x02900820, 0x02900840, 0x02900900, 0x02900c00, 0x02901001, 0x02901002, 0x02901004, 0x02901008,
+        0x02901020, 0x02901040, 0x02901100, 0x02901400, 0x02901800, 0x02902001, 0x02902002, 0x02902004,
+        0x02902008, 0x02902020, 0x02902040, 0x02902100, 0x02902400, 0x02902800, 0x02903000, 0x02904001,
+        0x02904002, 0x02904004, 0x02904008, 0x02904020, 0x02904040, 0x02904100, 0x02904400, 0x02904800,
+        0x02905000, 0x02906000, 0x02908001, 0x02908002, 0x02908004, 0x02908008, 0x02908020, 0x02908040,
+        0x02908100, 0x02908400, 0x02908800, 0x02909000, 0x0290a000, 0x0290c000, 0x02a00003, 0x02a00005,
+        0x02a00006, 0x02a00009, 0x02a0000a, 0x02a0000c, 0x02a00011, 0x02a00012, 0x02a00014, 0x02a00018,
+        0x02a00041, 0x02a00042, 0x02a00044, 0x02a00048, 0x02a00050, 0x02a00101, 0x02a00102, 0x02a00104,
+        0x02a00108, 0x02a00110, 0x02a00140, 0x02a00401, 0x02a00402, 0x02a00404, 0x02a00408, 0x02a00410,
+        0x02a00440, 0x02a00500, 0x02a00801, 0x02a00802, 0x02a00804, 0x02a00808, 0x02a00810, 0x02a00840,
+        0x02a00900, 0x02a00c00, 0x02a01001, 0x02a01002, 0x02a01004, 0x02a01008, 0x02a01010, 0x02a01040,
+        0x02a01100, 0x02a01400, 0x02a01800, 0x02a02001, 0x02a02002, 0x02a02004, 0x02a02008, 0x02a02010,
+        0x02a02040, 0x02a02100, 0x02a02400, 0x02a02800, 0x02a03000, 0x02a04001, 0x02a04002, 0x02a04004,
+        0x02a04008, 0x02a04010, 0x02a04040, 0x02a04100, 0x02a04400, 0x02a04800, 0x02a05000, 0x02a06000,
+        0x02a08001, 0x02a08002, 0x02a08004, 0x02a08008, 0x02a08010, 0x02a08040, 0x02a08100, 0x02a08400,
+        0x02a08800, 0x02a09000, 0x02a0a000, 0x02a0c000, 0x03080003, 0x03080005, 0x03080006, 0x03080011,
+        0x03080012, 0x03080014, 0x03080021, 0x03080022, 0x03080024, 0x03080030, 0x03080041, 0x03080042,
+        0x03080044, 0x03080050, 0x03080060, 0x03080081, 0x03080082, 0x03080084, 0x03080090, 0x030800a0,
+        0x030800c0, 0x03080401, 0x03080402, 0x03080404, 0x03080410, 0x03080420, 0x03080440, 0x03080480,
+        0x03080801, 0x03080802, 0x03080804, 0x03080810, 0x03080820, 0x03080840, 0x03080880, 0x03080c00,
+        0x03081001, 0x03081002, 0x03081004, 0x03081010, 0x03081020, 0x03081040, 0x03081080, 0x03081400,
+        0x03081800, 0x03082001, 0x03082002, 0x03082004, 0x03082010, 0x03082020, 0x03082040, 0x03082080,
+        0x03082400, 0x03082800, 0x03083000, 0x03084001, 0x03084002, 0x03084004, 0x03084010, 0x03084020,
+        0x03084040, 0x03084080, 0x03084400, 0x03084800, 0x03085000, 0x03086000, 0x03088001, 0x03088002,
+        0x03088004, 0x03088010, 0x03088020, 0x03088040, 0x03088080, 0x03088400, 0x03088800, 0x03089000,
+        0x0308a000, 0x0308c000, 0x05040003, 0x05040009, 0x0504000a, 0x05040012, 0x05040018, 0x05040021,
+        0x05040022, 0x05040028, 0x05040041, 0x05040042, 0x05040048, 0x05040050, 0x05040060, 0x05040081,
+        0x05040082, 0x05040088, 0x05040090, 0x050400a0, 0x050400c0, 0x05040208, 0x05040240, 0x05040280,
+        0x05040801, 0x05040802, 0x05040808, 0x05040810, 0x05040820, 0x05040840, 0x05040880, 0x05040a00,
+        0x05041008, 0x05041080, 0x05041800, 0x05042080, 0x05042800, 0x05044800, 0x05048001, 0x05048002,
+        0x05048008, 0x05048020, 0x05048040, 0x05048080, 0x05048800, 0x05080003, 0x05080005, 0x05080006,
+        0x05080011, 0x05080012, 0x05080014, 0x05080021, 0x05080022, 0x05080024, 0x05080030, 0x05080041,
+        0x05080042, 0x05080044, 0x05080050, 0x05080060, 0x05080081, 0x05080082, 0x05080084, 0x05080090,
+        0x050800a0, 0x050800c0, 0x05080201, 0x05080202, 0x05080204, 0x05080210, 0x05080220, 0x05080240,
+        0x05080280, 0x05080801, 0x05080802, 0x05080804, 0x05080810, 0x05080820, 0x05080840, 0x05080880,
+        0x05080a00, 0x05081001, 0x05081002, 0x05081004, 0x05081010, 0x05081020, 0x05081040, 0x05081080,
+        0x05081200, 0x05081800, 0x05082001, 0x05082002, 0x05082004, 0x05082010, 0x05082020, 0x05082040,
+        0x05082080, 0x05082200, 0x05082800, 0x05083000, 0x05084001, 0x05084002, 0x05084004, 0x05084010,
+        0x05084020, 0x05084040, 0x05084080, 0x05084200, 0x05084800, 0x05085000, 0x05086000, 0x05088001,
+        0x05088002, 0x05088004, 0x05088010, 0x05088020, 0x05088040, 0x05088080, 0x05088200, 0x05088800,
+        0x05089000, 0x0508a000, 0x0508c000, 0x09010006, 0x0901000a, 0x0901000c, 0x09010012, 0x09010014,
+        0x09010018, 0x09010022, 0x09010024, 0x09010028, 0x09010030, 0x09010042, 0x09010044, 0x09010048,
+        0x09010050, 0x09010060, 0x09010082, 0x09010084, 0x09010088, 0x09010090, 0x090100a0, 0x090100c0,
+        0x09010202, 0x09010204, 0x09010208, 0x09010210, 0x09010220, 0x09010240, 0x09010280, 0x09010402,
+        0x09010404, 0x09010408, 0x09010410, 0x09010420, 0x09010440, 0x09010480, 0x09010600, 0x09011002,
+        0x09011004, 0x09011008, 0x09011010, 0x09011020, 0x09011040, 0x09011080, 0x09011200, 0x09011400,
+        0x09012002, 0x09012004, 0x09012008, 0x09012010, 0x09012020, 0x09012040, 0x09012080, 0x09012200,
+        0x09012400, 0x09013000, 0x09014002, 0x09014004, 0x09014008, 0x09014010, 0x09014020, 0x09014040,
+        0x09014080, 0x09014200, 0x09014400, 0x09015000, 0x09016000, 0x09018002, 0x09018004, 0x09018008,
+        0x09018010, 0x09018020, 0x09018040, 0x09018080, 0x09018200, 0x09018400, 0x09019000, 0x0901a000,
+        0x0901c000, 0x09020005, 0x09020009, 0x0902000c, 0x09020011, 0x09020014, 0x09020018, 0x09020021,
+        0x09020024, 0x09020028, 0x09020030, 0x09020041, 0x09020044, 0x09020048, 0x09020050, 0x09020060,
+        0x09020081, 0x09020084, 0x09020088, 0x09020090, 0x090200a0, 0x090200c0, 0x09020201, 0x09020204,
+        0x09020208, 0x09020210, 0x09020220, 0x09020240, 0x09020280, 0x09020401, 0x09020404, 0x09020408,
+        0x09020410, 0x09020420, 0x09020440, 0x09020480, 0x09020600, 0x09021001, 0x09021004, 0x09021008,
+        0x09021010, 0x09021020, 0x09021040, 0x09021080, 0x09021200, 0x09021400, 0x09022001, 0x09022004,
+        0x09022008, 0x09022010, 0x09022020, 0x09022040, 0x09022080, 0x09022200, 0x09022400, 0x09023000,
+        0x09024001, 0x09024004, 0x09024008, 0x09024010, 0x09024020, 0x09024040, 0x09024080, 0x09024200,
+        0x09024400, 0x09025000, 0x09026000, 0x09028001, 0x09028004, 0x09028008, 0x09028010, 0x09028020,
+        0x09028040, 0x09028080, 0x09028200, 0x09028400, 0x09029000, 0x0902a000, 0x0902c000, 0x10080001,
+        0x10080002, 0x10080003, 0x10080004, 0x10080005, 0x10080006, 0x10080012, 0x10080014, 0x10080020,
+        0x10080021, 0x10080022, 0x10080024, 0x10080040, 0x10080041, 0x10080042, 0x10080044, 0x10080050,
+        0x10080060, 0x10080081, 0x10080082, 0x10080084, 0x10080090, 0x100800a0, 0x10080104, 0x10080140,
+        0x10080180, 0x10080240, 0x10080401, 0x10080402, 0x10080420, 0x10080801, 0x10080802, 0x10080810,
+        0x10088001, 0x10090006, 0x10090012, 0x10090014, 0x10090022, 0x10090024, 0x10090042, 0x10090044,
+        0x10090050, 0x10090060, 0x10090082, 0x10090084, 0x10090090, 0x100900a0, 0x100900c0, 0x10090104,
+        0x10090140, 0x10090180, 0x10090240, 0x10090280, 0x10090402, 0x10090404, 0x10090420, 0x10090440,
+        0x10090480, 0x10090802, 0x10090804, 0x10090810, 0x10090820, 0x10090840, 0x10090880, 0x10090900,
+        0x10090a00, 0x10090c00, 0x10092080, 0x10092800, 0x10094800, 0x10098002, 0x10098004, 0x10098020,
+        0x10098040, 0x10098080, 0x10098400, 0x10098800, 0x100a0005, 0x100a0011, 0x100a0014, 0x100a0021,
+        0x100a0024, 0x100a0030, 0x100a0041, 0x100a0044, 0x100a0050, 0x100a0060, 0x100a0081, 0x100a0084,
+        0x100a0090, 0x100a00a0, 0x100a00c0, 0x100a0101, 0x100a0104, 0x100a0110, 0x100a0120, 0x100a0140,
+        0x100a0180, 0x100a0201, 0x100a0204, 0x100a0210, 0x100a0220, 0x100a0240, 0x100a0280, 0x100a0300,
+        0x100a0401, 0x100a0404, 0x100a0410, 0x100a0420, 0x100a0440, 0x100a0480, 0x100a0500, 0x100a0600,
+        0x100a0801, 0x100a0804, 0x100a0810, 0x100a0820, 0x100a0840, 0x100a0880, 0x100a0900, 0x100a0a00,
+        0x100a0c00, 0x100a2001, 0x100a2004, 0x100a2010, 0x100a2020, 0x100a2040, 0x100a2080, 0x100a2100,
+        0x100a2200, 0x100a2400, 0x100a2800, 0x100a4001, 0x100a4004, 0x100a4010, 0x100a4020, 0x100a4040,
+        0x100a4080, 0x100a4100, 0x100a4200, 0x100a4400, 0x100a4800, 0x100a6000, 0x100a8001, 0x100a8004,
+        0x100a8010, 0x100a8020, 0x100a8040, 0x100a8080, 0x100a8100, 0x100a8200, 0x100a8400, 0x100a8800,
+        0x100aa000, 0x100ac000, 0x100c0003, 0x100c0011, 0x100c0012, 0x100c0021, 0x100c0022, 0x100c0030,
+        0x100c0041, 0x100c0042, 0x100c0050, 0x100c0060, 0x100c0081, 0x100c0082, 0x100c0090, 0x100c00a0,
+        0x100c00c0, 0x100c0101, 0x100c0102, 0x100c0110, 0x100c0120, 0x100c0140, 0x100c0180, 0x100c0201,
+        0x100c0202, 0x100c0210, 0x100c0220, 0x100c0240, 0x100c0280, 0x100c0300, 0x100c0401, 0x100c0402,
+        0x100c0410, 0x100c0420, 0x100c0440, 0x100c0480, 0x100c0500, 0x100c0600, 0x100c0801, 0x100c0802,
+        0x100c0810, 0x100c0820, 0x100c0840, 0x100c0880, 0x100c0900, 0x100c0a00, 0x100c0c00, 0x100c2001,
+        0x100c2002, 0x100c2010, 0x100c2020, 0x100c2040, 0x100c2080, 0x100c2100, 0x100c2200, 0x100c2400,
+        0x100c2800, 0x100c4001, 0x100c4002, 0x100c4010, 0x100c4020, 0x100c4040, 0x100c4080, 0x100c4100,
+        0x100c4200, 0x100c4400, 0x100c4800, 0x100c6000, 0x100c8001, 0x100c8002, 0x100c8010, 0x100c8020,
+        0x100c8040, 0x100c8080, 0x100c8100, 0x100c8200, 0x100c8400, 0x100c8800, 0x100ca000, 0x100cc000,
+        0x10280003, 0x10280005, 0x10280006, 0x10280012, 0x10280014, 0x10280041, 0x10280042, 0x10280044,
+        0x10280050, 0x10280081, 0x10280082, 0x10280084, 0x10280090, 0x102800c0, 0x10280104, 0x10280140,
+        0x10280180, 0x10280240, 0x10280280, 0x10280401, 0x10280402, 0x10280404, 0x10280440, 0x10280480,
+        0x10280801, 0x10280802, 0x10280804, 0x10280810, 0x10280840, 0x10280880, 0x10280900, 0x10280a00,
+        0x10280c00, 0x10282080, 0x10282800, 0x10284800, 0x10288001, 0x10288002, 0x10288004, 0x10288040,
+        0x10288080, 0x10288400, 0x10288800, 0x10480003, 0x10480005, 0x10480006, 0x10480011, 0x10480012,
+        0x10480014, 0x10480021, 0x10480022, 0x10480024, 0x10480030, 0x10480081, 0x10480082, 0x10480084,
+        0x10480090, 0x104800a0, 0x10480101, 0x10480102, 0x10480104, 0x10480110, 0x10480120, 0x10480180,
+        0x10480201, 0x10480202, 0x10480204, 0x10480210, 0x10480220, 0x10480300, 0x10480401, 0x10480402,
+        0x10480410, 0x10480420, 0x10480500, 0x10480801, 0x10480802, 0x10480810, 0x10480900, 0x10482001,
+        0x10482010, 0x10482100, 0x10484001, 0x10484010, 0x10488001, 0x10810006, 0x1081000a, 0x1081000c,
+        0x10810012, 0x10810014, 0x10810018, 0x10810022, 0x10810024, 0x10810028, 0x10810030, 0x10810042,
+        0x10810044, 0x10810048, 0x10810050, 0x10810060, 0x10810102, 0x10810104, 0x10810108, 0x10810110,
+        0x10810120, 0x10810140, 0x10810202, 0x10810204, 0x10810208, 0x10810210, 0x10810220, 0x10810240,
+        0x10810300, 0x10810402, 0x10810404, 0x10810408, 0x10810410, 0x10810420, 0x10810440, 0x10810500,
+        0x10810600, 0x10810802, 0x10810804, 0x10810808, 0x10810810, 0x10810820, 0x10810840, 0x10810900,
+        0x10810a00, 0x10810c00, 0x10812002, 0x10812004, 0x10812008, 0x10812010, 0x10812020, 0x10812040,
+        0x10812100, 0x10812200, 0x10812400, 0x10812800, 0x10814002, 0x10814004, 0x10814008, 0x10814010,
+        0x10814020, 0x10814040, 0x10814100, 0x10814200, 0x10814400, 0x10814800, 0x10816000, 0x10818002,
+        0x10818004, 0x10818008, 0x10818010, 0x10818020, 0x10818040, 0x10818100, 0x10818200, 0x10818400,
+        0x10818800, 0x1081a000, 0x1081c000, 0x10820005, 0x10820009, 0x1082000c, 0x10820011, 0x10820014,
+        0x10820018, 0x10820021, 0x10820024, 0x10820028, 0x10820030, 0x10820041, 0x10820044, 0x10820048,
+        0x10820050, 0x10820060, 0x10820101, 0x10820104, 0x10820108, 0x10820110, 0x10820120, 0x10820140,
+        0x10820201, 0x10820204, 0x10820208, 0x10820210, 0x10820220, 0x10820240, 0x10820300, 0x10820401,
+        0x10820404, 0x10820408, 0x10820410, 0x10820420, 0x10820440, 0x10820500, 0x10820600, 0x10820801,
+        0x10820804, 0x10820808, 0x10820810, 0x10820820, 0x10820840, 0x10820900, 0x10820a00, 0x10820c00,
+        0x10822001, 0x10822004, 0x10822008, 0x10822010, 0x10822020, 0x10822040, 0x10822100, 0x10822200,
+        0x10822400, 0x10822800, 0x10824001, 0x10824004, 0x10824008, 0x10824010, 0x10824020, 0x10824040,
+        0x10824100, 0x10824200, 0x10824400, 0x10824800, 0x10826000, 0x10828001, 0x10828004, 0x10828008,
+        0x10828010, 0x10828020, 0x10828040, 0x10828100, 0x10828200, 0x10828400, 0x10828800, 0x1082a000,
+        0x1082c000, 0x10840003, 0x10840009, 0x1084000a, 0x10840011, 0x10840012, 0x10840018, 0x10840021,
+        0x10840022, 0x10840028, 0x10840030, 0x10840041, 0x10840042, 0x10840048, 0x10840050, 0x10840060,
+        0x10840101, 0x10840102, 0x10840108, 0x10840110, 0x10840120, 0x10840140, 0x10840201, 0x10840202,
+        0x10840208, 0x10840210, 0x10840220, 0x10840240, 0x10840300, 0x10840401, 0x10840402, 0x10840410,
+        0x10840420, 0x10840500, 0x10840801, 0x10840802, 0x10840810, 0x10840900, 0x10842001, 0x10842010,
+        0x10842100, 0x10844001, 0x10844010, 0x10848001, 0x18020005, 0x18020009, 0x1802000c, 0x18020011,
+        0x18020014, 0x18020018, 0x18020021, 0x18020024, 0x18020028, 0x18020030, 0x18020041, 0x18020044,
+        0x18020048, 0x18020050, 0x18020060, 0x18020081, 0x18020084, 0x18020090, 0x180200a0, 0x18020101,
+        0x18020104, 0x18020108, 0x18020110, 0x18020120, 0x18020140, 0x18020180, 0x18020201, 0x18020204,
+        0x18020208, 0x18020210, 0x18020220, 0x18020240, 0x18020300, 0x18020401, 0x18020410, 0x18020420,
+        0x18020500, 0x18022001, 0x18022010, 0x18022100, 0x18024001, 0x18024010, 0x18028001,
+  };
+
+const uint16_t BOOK4_INFO[BOOK4_SIZE] PROGMEM = {
+        0x0030, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0033, 0x0032, 0x0034, 0x0032, 0x0033, 0x0032, 0x0032, 0x0033, 0x0032,
+        0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0033, 0x0031, 0x0034, 0x0031, 0x0033, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0033,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0034, 0x0030,
+        0x0033, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0035, 0x0034, 0x0033, 0x0034, 0x0033, 0x0033, 0x0034,
+        0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0033, 0x0033,
+        0x0033, 0x0033, 0x0034, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0033,
+        0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033,
+        0x0033, 0x0033, 0x0034, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033,
+        0x0034, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0034,
+        0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0033, 0x0032,
+        0x0034, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0035, 0x0034, 0x0032, 0x0034, 0x0032,
+        0x0032, 0x0034, 0x0032, 0x0032, 0x0032, 0x0034, 0x0032, 0x0032, 0x0032, 0x0032, 0x0034, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0034, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0034,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0034, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0034, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0034, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0034, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0030, 0x0033, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0035, 0x0033, 0x0032, 0x0033, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0033,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0031, 0x0030, 0x0033, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0035, 0x0033, 0x0031, 0x0033, 0x0031, 0x0031, 0x0033,
+        0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0035,
+        0x0033, 0x0030, 0x0033, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0035, 0x0032, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0035, 0x0032, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0035, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0033, 0x0031, 0x0032, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0030, 0x0033, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0034, 0x0033, 0x0032, 0x0033, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032,
+        0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0032, 0x0031, 0x0030, 0x0033, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0034, 0x0033, 0x0031, 0x0033, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031,
+        0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0034, 0x0033, 0x0030,
+        0x0033, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0034, 0x0032, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0034, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0034, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0033, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0032,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0031,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0032, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037, 0x0030, 0x0037, 0x0037, 0x0037,
+        0x0037, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037,
+        0x0037, 0x0037, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0030, 0x0037,
+        0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037,
+        0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037,
+        0x0037, 0x0037, 0x0037, 0x0037, 0x0030, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037, 0x0037,
+        0x0031, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0032, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0036, 0x0036, 0x0036, 0x0036,
+        0x0036, 0x0036, 0x0031, 0x0030, 0x0030, 0x0030, 0x0036, 0x0036, 0x0036, 0x0036, 0x0030, 0x0036,
+        0x0036, 0x0036, 0x0036, 0x0030, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0030, 0x0036, 0x0036,
+        0x0036, 0x0036, 0x0036, 0x0036, 0x0030, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036,
+        0x0030, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0030, 0x0036, 0x0036,
+        0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0030, 0x0036, 0x0036, 0x0036, 0x0036,
+        0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036, 0x0030, 0x0036, 0x0036, 0x0036, 0x0036, 0x0036,
+        0x0036, 0x0036, 0x0031, 0x0030, 0x0033, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0034, 0x0033, 0x0031, 0x0033, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0033,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0033, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0034, 0x0033, 0x0030,
+        0x0033, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0033, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0034, 0x0032, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0034, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0034, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0033, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0032,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0031,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0031, 0x0033, 0x0032, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0031, 0x0034, 0x0032, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0034, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0034, 0x0031, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0033, 0x0032, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0032, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0033, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x003c, 0x003c, 0x003c, 0x003c,
+        0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c,
+        0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c, 0x003c,
+        0x003c, 0x003c, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x003c, 0x003c, 0x003c, 0x003c,
+        0x003c, 0x003c, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0032, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0031, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0031, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033,
+        0x0032, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0032, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0034, 0x0032, 0x0031,
+        0x0032, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0034, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0034, 0x0031,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0039,
+        0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+        0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0039,
+        0x0039, 0x0039, 0x0039, 0x0039, 0x0039, 0x0033, 0x0032, 0x0031, 0x0032, 0x0031, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0031, 0x0031, 0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031,
+        0x0032, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0032,
+        0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0031, 0x0033,
+        0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0033, 0x0031, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031,
+        0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0030, 0x0031, 0x0030, 0x0030, 0x0031, 0x0030, 0x0031,
+        0x0033, 0x0032, 0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030,
+        0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030,
+        0x0030, 0x0030, 0x0032, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0032, 0x0030, 0x0030,
+        0x0030, 0x0032, 0x0030, 0x0030, 0x0032, 0x0030, 0x0032,
+  };
+
+#endif
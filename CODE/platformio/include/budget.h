@@ -0,0 +1,28 @@
+/*
+  *@budget overview
+  *           SRAM each module may use for its own state, in bytes
+  *           the modules check themselves with static_assert, so a change
+  *           that outgrows its share fails to compile
+  *                 |-> port pointers are left out, they double on a host
+  *           the whole image (with the Arduino core) is checked after the
+  *           link by tools/sram_budget.py against custom_sram_budget in
+  *           platformio.ini, what is left is stack for the search and ISRs
+  *
+*/
+
+#ifndef BUDGET_H
+#define BUDGET_H
+
+#include <stddef.h>
+
+const size_t BUDGET_GAME = 64;       // GameState
+const size_t BUDGET_DISPLAY = 176;   // two BCM frames plus port masks
+const size_t BUDGET_INPUT = 96;      // debounce state and the event ring
+const size_t BUDGET_SEARCH = 176;    // explicit stack, killers and SearchState, TT is TT_SRAM_BUDGET
+const size_t BUDGET_PROTOCOL = 720;  // frame, batch and tx ring
+const size_t BUDGET_SCHED = 96;      // task deadlines and stats
+const size_t BUDGET_MCTS = 24;       // root, counters and Rng, the arena is MCTS_SRAM_BUDGET
+const size_t BUDGET_ANIM = 24;       // keyframe position, colour slots and Rng
+const size_t BUDGET_GLOG = 96;       // lifetime totals, ring head and the game being recorded
+
+#endif
@@ -0,0 +1,81 @@
+/*
+  *@display overview
+  *           the matrix is scanned one column ground at a time by the
+  *           Timer1 compare interrupt, so the refresh rate no longer depends
+  *           on how long loop() takes
+  *           every colour channel has 16 levels (0 - LED_MAX) shown with
+  *           binary code modulation
+  *                 |-> a level goes through the gamma table to a 6 bit duty
+  *                 |-> each column is shown as 6 bit planes, plane b lasts
+  *                     DISPLAY_BCM_BASE_TICKS << b timer ticks and has the
+  *                     channels with bit b of their duty set
+  *           displayShow() turns the game's LedColor board into the PORTx bytes for every
+  *           column and plane once and hands them to the interrupt through
+  *           a double buffer, the interrupt itself only does a few register
+  *           writes and reloads OCR1A
+  *                 |-> OCR1A is reloaded first, a plane may be 3 ticks, and
+  *                     if the count still got past it the plane is
+  *                     restarted, CTC would otherwise run to 0xFFFF first
+  *@frame handoff
+  *           the interrupt only ever reads the front frame, displayShow()
+  *           only ever writes the back one, no interrupts are turned off
+  *                 |-> publish   displayShow() clears displayPending, builds
+  *                               the back frame, then sets it again
+  *                 |-> swap      the interrupt swaps front and back at the
+  *                               start of a refresh when displayPending is
+  *                               set, so a refresh never mixes two frames
+  *                               and a new frame shows within one refresh
+  *           both flags are single bytes, so each side's read or write of
+  *           them is atomic on the AVR
+  *           the frame itself is plain memory, volatile only keeps the flag
+  *           writes in order with each other, so a compiler barrier sits
+  *           after clearing displayPending and before setting it, else the
+  *           compiler may move back frame stores outside the two and the
+  *           interrupt could swap in a half built frame
+  *           a board equal to the last one published is not built again,
+  *           so repainting unchanged leds only costs comparing the 9 leds
+  *
+  *@cpu budget
+  *           clk/64 -> 4us ticks, base plane 3 ticks
+  *           one column == 63 * 3 ticks == 756us, refresh == 3 columns ==
+  *           2.27ms (~440Hz)
+  *           18 interrupts per refresh (~7900/s) at ~80 cycles each is about
+  *           4% of the 16MHz CPU; keep the interrupt under 5% when changing
+  *           any of the numbers below
+  *
+*/
+
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include "hardware.h"
+
+const int LED_MAX = 15;                // brightest level of a channel
+const int DISPLAY_BCM_BITS = 6;        // duty resolution after gamma
+const int DISPLAY_BCM_BASE_TICKS = 3;  // ticks of the shortest plane
+const int DISPLAY_TICK_US = 4;         // Timer1 at clk/64
+const int DISPLAY_MAX_PORTS = 4;       // the shield uses PORTB, E, G and H
+
+// one led, a 0 - LED_MAX level per colour plus on/off packed in 2 bytes
+struct LedColor {
+  uint8_t r : 4;
+  uint8_t g : 4;
+  uint8_t b : 4;
+  uint8_t on : 1;
+};
+static_assert(LED_MAX < 16, "levels are 4 bit fields in LedColor");
+
+// level of colour channel 0 (red) - 2 (blue)
+inline uint8_t ledLevel(const LedColor &c, int channel){
+  return channel == 0 ? c.r : channel == 1 ? c.g : c.b;
+}
+
+// call once from setup() after the pins are outputs
+void displayBegin();
+// build a frame from the leds and show it from the next refresh on, false
+// if they are the same as last time and nothing was done
+bool displayShow(const LedColor color[ROW][COL]);
+// blank the matrix
+void displayClear();
+
+#endif
@@ -0,0 +1,384 @@
+/*
+  *@engine overview
+  *           alpha-beta minimax for any two player game, header only
+  *           same iterative, time sliced walk as search.cpp (see search.h),
+  *           the game is a template argument so every call is resolved at
+  *           compile time, no virtual calls
+  *                 |-> Engine<Game> e; e.begin(state) once
+  *                 |-> e.step(us) every loop() until it returns true
+  *                 |-> e.move() / e.score() hold the answer
+  *           begin() can also take a depth limit, heuristic() scores the
+  *           positions it cuts off, a move to try first at the root and a
+  *           node limit, Deepening<Game> below runs deeper and deeper
+  *           limited searches for an anytime answer
+  *           a Game is a struct of static members
+  *                 |-> State, Move          types, Move a small int
+  *                 |-> MAX_PLIES            longest game from any position
+  *                 |-> NO_MOVE              Move that is never legal
+  *                 |-> WIN                  score of a won game, the engine
+  *                                          takes one off per ply
+  *                 |-> nextMove(s, cursor, m)  moves one at a time, cursor
+  *                                          starts at 0, false when done
+  *                 |-> make(s, m) / unmake(s, m)
+  *                 |-> terminal(s)
+  *                 |-> evaluate(s)          terminal score of the first
+  *                                          player, WIN / -WIN / 0
+  *                 |-> heuristic(s)         guess at a position the depth
+  *                                          limit cuts off, well inside
+  *                                          WIN - MAX_PLIES
+  *                 |-> maximising(s)        first player to move
+  *                 |-> probe(s, depth, bound, value, m) / store(...)
+  *                                          transposition table or no-ops,
+  *                                          bounds as in ttable.h, a move
+  *                                          from a probe that does not cut
+  *                                          is searched first
+  *                 |-> book(s, m, score)    known answer for Deepening to
+  *                                          skip the search, false if none
+  *           see tictactoe.h, hexapawn.h and mnk.h
+  *
+*/
+
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <stdint.h>
+#include "hal.h"
+#include "ttable.h"
+
+const int ENGINE_INF = 30000;
+// check the clock every few nodes, micros() is not free on AVR
+const uint8_t ENGINE_CLOCK_NODES = 8;
+
+template <class Game>
+class Engine {
+public:
+  typedef typename Game::State State;
+  typedef typename Game::Move Move;
+
+  // maxDepth < MAX_PLIES cuts the tree off with heuristic() and leaves the
+  // transposition table alone like search.cpp, the scores are not exact,
+  // first must be one of the root's moves, maxNodes 0 == no limit
+  void begin(const State &root, uint8_t maxDepth = Game::MAX_PLIES,
+             Move first = Game::NO_MOVE, unsigned long maxNodes = 0){
+    state = root;
+    depth = 0;
+    count = 0;
+    limit = maxDepth;
+    firstMove = first;
+    nodeLimit = maxNodes;
+    cutOff = false;
+    stopped = false;
+    bestMove = Game::NO_MOVE;
+    bestScore = 0;
+    busy = true;
+    push(-ENGINE_INF, ENGINE_INF);
+  }
+
+  // runs for at most budgetUs microseconds, true once the search is done
+  bool step(unsigned long budgetUs){
+    unsigned long start = micros();
+    uint8_t nodes = 0;
+    while(busy){
+      visit();
+      if(nodeLimit && count >= nodeLimit && busy){
+        // out of nodes, move() and score() stay unset
+        busy = false;
+        stopped = true;
+        break;
+      }
+      if(++nodes == ENGINE_CLOCK_NODES){
+        nodes = 0;
+        if(micros() - start >= budgetUs)
+          break;
+      }
+    }
+    return !busy;
+  }
+
+  bool running() const { return busy; }
+  Move move() const { return bestMove; }     // NO_MOVE if the game is over
+  int score() const { return bestScore; }    // first player wins > 0
+  unsigned long nodes() const { return count; }
+  bool aborted() const { return stopped; }  // hit the node limit
+  bool exact() const { return !cutOff; }    // no position was cut off
+
+private:
+  struct Frame {
+    int16_t alpha;
+    int16_t beta;
+    Move best;      // best move so far, NO_MOVE == none
+    Move first;     // searched before nextMove()'s, NO_MOVE == none
+    Move current;   // move being searched below this frame, NO_MOVE == none
+    uint8_t cursor; // Game::nextMove() position
+  };
+
+  State state;
+  Frame stack[Game::MAX_PLIES + 1];
+  uint8_t depth;   // frame on top of the stack
+  bool enter;      // top frame has not been looked at yet
+  bool busy;
+  int returned;    // value handed from a finished frame to its parent
+  Move bestMove;
+  int bestScore;
+  unsigned long count;
+  uint8_t limit;       // depth the tree is cut off at
+  Move firstMove;      // tried first at the root, NO_MOVE == none
+  unsigned long nodeLimit;
+  bool cutOff;         // a position was cut off by the limit
+  bool stopped;
+
+  void push(int alpha, int beta){
+    Frame &f = stack[depth];
+    f.alpha = alpha;
+    f.beta = beta;
+    f.best = Game::NO_MOVE;
+    f.current = Game::NO_MOVE;
+    f.first = Game::NO_MOVE;
+    f.cursor = 0;
+    enter = true;
+  }
+  void pop(int value, Move m){
+    if(depth == 0){
+      bestScore = value;
+      bestMove = m;
+      busy = false;
+      return;
+    }
+    depth--;
+    returned = value;
+  }
+
+  int terminalScore(){
+    // counted from the root -> prefer the quickest win and the slowest loss
+    int value = Game::evaluate(state);
+    if(value > 0){
+      return value - depth;
+    }else if(value < 0){
+      return value + depth;
+    }
+    return 0;
+  }
+
+  void store(uint8_t bound, int value, Move m){
+    if(limit >= Game::MAX_PLIES)
+      Game::store(state, depth, bound, value, m);
+  }
+
+  bool probe(const Frame &f, int &value, Move &m){
+    // transposition table cut -> same fail-hard result the search would give
+    uint8_t bound;
+    if(limit < Game::MAX_PLIES || !Game::probe(state, depth, bound, value, m)){
+      m = Game::NO_MOVE;
+      return false;
+    }
+    if(bound == TT_LOWER && value >= f.beta){
+      value = f.beta;
+    }else if(bound == TT_UPPER && value <= f.alpha){
+      value = f.alpha;
+    }else if(bound == TT_EXACT){
+      if(value > f.beta)
+        value = f.beta;
+      if(value < f.alpha)
+        value = f.alpha;
+    }else{
+      return false;
+    }
+    return true;
+  }
+
+  // one visit of the top frame: enter it, take a child's result or open the
+  // next child
+  void visit(){
+    Frame &f = stack[depth];
+
+    if(enter){
+      enter = false;
+      count++;
+      if(Game::terminal(state)){
+        pop(terminalScore(), Game::NO_MOVE);
+        return;
+      }
+      int value;
+      Move m;
+      if(probe(f, value, m)){
+        pop(value, m);
+        return;
+      }
+      if(depth >= limit){
+        cutOff = true;
+        pop(Game::heuristic(state), Game::NO_MOVE);
+        return;
+      }
+      // mate distance -> nothing here beats a win with the next move or
+      // is worse than a loss to the reply, like search.cpp
+      int reach = Game::WIN - depth - 1;
+      if(f.alpha < -reach)
+        f.alpha = -reach;
+      if(f.beta > reach)
+        f.beta = reach;
+      if(f.alpha >= f.beta){
+        pop(f.alpha, Game::NO_MOVE);
+        return;
+      }
+      // the table's move, or the one begin() was given at the root
+      f.first = depth == 0 && firstMove != Game::NO_MOVE ? firstMove : m;
+      if(f.first != Game::NO_MOVE){
+        f.current = f.first;
+        Game::make(state, f.first);
+        depth++;
+        push(f.alpha, f.beta);
+        return;
+      }
+    }
+
+    Move m = f.current;
+    if(m != Game::NO_MOVE){
+      f.current = Game::NO_MOVE;
+      Game::unmake(state, m);
+    }
+    bool maximise = Game::maximising(state);
+
+    if(m != Game::NO_MOVE){
+      if(maximise){
+        if(returned >= f.beta){
+          store(TT_LOWER, f.beta, m);
+          pop(f.beta, m);
+          return;
+        }
+        if(returned > f.alpha){
+          f.alpha = returned;
+          f.best = m;
+        }
+      }else{
+        if(returned <= f.alpha){
+          store(TT_UPPER, f.alpha, m);
+          pop(f.alpha, m);
+          return;
+        }
+        if(returned < f.beta){
+          f.beta = returned;
+          f.best = m;
+        }
+      }
+    }
+
+    bool more;
+    do{
+      more = Game::nextMove(state, f.cursor, m);
+    }while(more && m == f.first);
+    if(more){
+      f.current = m;
+      Game::make(state, m);
+      depth++;
+      push(f.alpha, f.beta);
+      return;
+    }
+
+    // every child searched
+    int value = maximise ? f.alpha : f.beta;
+    if(f.best == Game::NO_MOVE){
+      store(maximise ? TT_UPPER : TT_LOWER, value, Game::NO_MOVE);
+    }else{
+      store(TT_EXACT, value, f.best);
+    }
+    pop(value, f.best);
+  }
+};
+
+// iterative deepening over Engine<Game>: depth 1, 2, 3.. each starting with
+// the best move of the one before, stops when a search was exact (nothing
+// cut off), found a win or loss, or ran out of nodes or time
+//      |-> d.begin(state, maxNodes, maxUs) once, 0 == no limit
+//      |-> d.step(us) every loop() until it returns true, d.stop() to take
+//          the deepest finished answer early
+// a search the budget stops half way is thrown away, a book() hit skips the
+// search, depth 1 always finishes so there is always a move
+template <class Game>
+class Deepening {
+public:
+  typedef typename Game::State State;
+  typedef typename Game::Move Move;
+
+  void begin(const State &root, unsigned long maxNodes = 0, unsigned long maxUs = 0){
+    state = root;
+    nodeBudget = maxNodes;
+    timeBudget = maxUs;
+    total = 0;
+    spent = 0;
+    limit = 0;
+    finished = 0;
+    bestMove = Game::NO_MOVE;
+    bestScore = 0;
+    busy = true;
+    if(Game::book(root, bestMove, bestScore)){
+      busy = false;
+      return;
+    }
+    deeper();
+  }
+
+  bool step(unsigned long budgetUs){
+    unsigned long start = micros();
+    while(busy){
+      unsigned long used = micros() - start;
+      if(used >= budgetUs)
+        break;
+      bool done = engine.step(budgetUs - used);
+      if(!done)
+        break;
+      total += engine.nodes();
+      if(engine.aborted()){
+        stop();
+        break;
+      }
+      bestMove = engine.move();
+      bestScore = engine.score();
+      finished = limit;
+      int solved = Game::WIN - Game::MAX_PLIES;
+      if(engine.exact() || bestScore >= solved || bestScore <= -solved || limit == Game::MAX_PLIES){
+        busy = false;
+        break;
+      }
+      deeper();
+    }
+    spent += micros() - start;
+    if(busy && timeBudget && spent >= timeBudget && finished)
+      stop();
+    return !busy;
+  }
+
+  // answer from the deepest finished search, once depth() > 0
+  void stop(){
+    busy = false;
+  }
+
+  bool running() const { return busy; }
+  Move move() const { return bestMove; }
+  int score() const { return bestScore; }
+  uint8_t depth() const { return finished; }  // 0 == from the book
+  unsigned long nodes() const { return busy ? total + engine.nodes() : total; }
+
+private:
+  Engine<Game> engine;
+  State state;
+  unsigned long nodeBudget;
+  unsigned long timeBudget;
+  unsigned long total;   // nodes of the finished searches
+  unsigned long spent;   // microseconds inside step()
+  uint8_t limit;         // depth being searched
+  uint8_t finished;      // deepest finished depth
+  Move bestMove;
+  int bestScore;
+  bool busy;
+
+  void deeper(){
+    limit++;
+    // depth 1 runs to the end whatever the budget says
+    unsigned long left = 0;
+    if(nodeBudget && limit > 1)
+      left = nodeBudget > total ? nodeBudget - total : 1;
+    engine.begin(state, limit, bestMove, left);
+  }
+};
+
+#endif
@@ -0,0 +1,71 @@
+/*
+  *@game overview
+  *           rules, AI moves and the screen state machine, see game.cpp
+  *           only depends on hal.h, so it builds for the MEGA and the host
+  *           every bit of game state lives in the one GameState below, small
+  *           ints and bitfields only, see budget.h for what it may cost
+  *           the rules and the AI are the GameSession inside it, see
+  *           session.h, the rest is screens, cursor and LEDs
+  *
+*/
+
+#ifndef GAME_H
+#define GAME_H
+
+#include "hardware.h"
+#include "bitboard.h"
+#include "display.h"
+#include "session.h"
+#include "scheduler.h"
+
+const int PAIR = 2;
+
+struct GameState {
+  GameSession session;        // board, AI mode and side, winner
+  LedColor color[ROW][COL];   // what drawBoard() hands to the display
+  uint16_t winLine;           // cells of the winning line, 0 == none
+  uint32_t currentTime;       // millis() when the input task started
+  uint32_t blinkDue;          // millis() of the next blink, see schedDue()
+  uint32_t pauseDue;          // millis() the pause screen ends
+  uint32_t idleDue;           // millis() the start screen goes to attract mode
+  uint32_t aiCycles;          // cpu time of the current AI move, see profile.h
+  int8_t mode;                // screen loop() runs -> start(0)/game(1)/end(3)/party(4)
+  int8_t pos[PAIR];           // current position (x,y)
+  int8_t idxXcolor;           // allColor index of X
+  int8_t idxOcolor;           // allColor index of O
+  uint8_t buttons;            // bit b set == button b pressed this frame
+  uint8_t XO_turn : 1;        // -> X = 1, O = 0
+  uint8_t aiThinking : 1;     // aiTask() has not finished the AI's move yet
+  uint8_t firstAiMove : 1;
+  uint8_t instSwitch : 1;
+  uint8_t isOnOff : 1;
+  uint8_t new_turn : 1;
+  uint8_t new_game : 1;
+  uint8_t instPartyTime : 1;
+  uint8_t instPauseTime : 1;
+  uint8_t dirty : 1;          // color changed since the last drawBoard()
+};
+extern GameState game;
+
+// up(0), right(1), down(2), left(3), select(4)
+inline bool buttonEvent(uint8_t button){
+  return game.buttons & (1 << button);
+}
+
+void gameSetup();
+int startScreen();
+int gameScreen();
+int endScreen();
+int partyScreen();
+void pauseScreen();
+
+// scheduler tasks, see main.cpp
+void aiTask();
+
+void checkButton(bool checkCancel);
+void drawBoard();
+void allOff();
+
+void printBoard(const Board &board);
+
+#endif
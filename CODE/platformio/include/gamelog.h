@@ -0,0 +1,92 @@
+/*
+  *@gamelog overview
+  *           every finished game goes to EEPROM, so a unit in the field
+  *           keeps its usage data without a Serial cable
+  *           layout of the 4KB
+  *                 |-> 2 checkpoint slots   lifetime win/draw/loss per mode
+  *                                          as of the last lap, CRC checked,
+  *                                          written alternately so a reset
+  *                                          mid write keeps the older one
+  *                 |-> ring of 4 byte records, one per game, appended at
+  *                     head, when it is full the totals are checkpointed and
+  *                     the next lap overwrites it from the start
+  *           a record has a lap bit (laps & 1), the boot scan counts records
+  *           from the start while the bit matches, that is the head and
+  *           the current lap's games go on top of the checkpoint
+  *           a record (little endian uint32)
+  *                 |-> bits 0-18   order of the moves as a mixed radix
+  *                                 number, digit i is which of the 9-i empty
+  *                                 cells move i took, 9!/.. < 2^19
+  *                 |-> bits 19-22  moves, 5 - 9
+  *                 |-> bits 23-25  AI mode
+  *                 |-> bit 26      two player game
+  *                 |-> bit 27      the AI played X
+  *                 |-> bit 28      colours changed from the defaults
+  *                 |-> bit 29      lap bit
+  *                 |-> bits 30-31  0, erased EEPROM (0xFF) is never a record
+  *           wear -> a record byte is written once a lap and a checkpoint
+  *           slot every other lap, ~1000 games a lap
+  *           writes take 3.4ms a byte, glogPoll() (a scheduler task) does
+  *           one byte a call so the game never waits on the EEPROM
+  *
+*/
+
+#ifndef GAMELOG_H
+#define GAMELOG_H
+
+#include <stdint.h>
+#include "hal.h"
+#include "bitboard.h"
+#include "game.h"
+
+// stats rows, the AI modes then two player games
+const uint8_t GLOG_TWO_PLAYER = AI_MODES;
+const uint8_t GLOG_ROWS = AI_MODES + 1;
+// stats columns, for the human player against the AI, X in two player games
+const uint8_t GLOG_WIN = 0;
+const uint8_t GLOG_DRAW = 1;
+const uint8_t GLOG_LOSS = 2;
+const uint8_t GLOG_RESULTS = 3;
+
+const uint16_t GLOG_CHECKPOINT_SLOT = 80;  // bytes per checkpoint slot
+const uint16_t GLOG_RING_START = 2 * GLOG_CHECKPOINT_SLOT;
+const uint16_t GLOG_RECORD = 4;
+const uint16_t GLOG_RECORDS = (E2END + 1 - GLOG_RING_START) / GLOG_RECORD;
+
+// lifetime totals, also the checkpoint image and the PROTO_STATS reply
+struct GlogTotals {
+  uint32_t laps;                             // times the ring filled up
+  uint32_t games[GLOG_ROWS][GLOG_RESULTS];
+  uint16_t crc;                              // protoCrc() of the above
+};
+static_assert(sizeof(GlogTotals) <= GLOG_CHECKPOINT_SLOT, "checkpoint outgrew its slot");
+
+// a record unpacked
+struct GlogGame {
+  uint8_t moves[BB_CELLS];   // cells in the order they were played
+  uint8_t count;
+  uint8_t mode;
+  bool twoPlayer;
+  bool aiX;
+  bool customColors;
+};
+
+// boot, reads the checkpoints and scans the ring
+void glogBegin();
+// a new game, glogMove() every placed piece, glogFinish() once it is over
+void glogStart(uint8_t mode, bool twoPlayer, bool aiX, bool customColors);
+void glogMove(uint8_t cell);
+void glogFinish();
+// scheduler task, writes at most one EEPROM byte
+void glogPoll();
+// true until everything queued is in the EEPROM
+bool glogBusy();
+
+const GlogTotals &glogTotals();
+uint16_t glogStored();                 // records in the ring
+uint32_t glogRecord(uint16_t back);    // raw record, 0 == newest
+bool glogDecode(uint32_t record, GlogGame &game);
+// GLOG_WIN/DRAW/LOSS of a decoded game, -1 if it did not finish
+int8_t glogResult(const GlogGame &game);
+
+#endif
@@ -0,0 +1,153 @@
+/*
+  *@hal overview
+  *           the only header the game code includes for hardware access
+  *           on the MEGA it is just Arduino.h
+  *           on a host (env:native) it provides stand-ins with the same
+  *           names, so the same sources build and run on Linux
+  *                 |-> pins are bits in fake PORTx registers laid out like
+  *                     the MEGA's, so port level code sees real bit masks
+  *                 |-> millis()/micros() follow the wall clock, or a
+  *                     simulated clock that only moves with halAdvance(),
+  *                     or one that also runs at wall speed while code runs
+  *                     so time budgets work and idle time is skipped
+  *                 |-> timer interrupts are callbacks fired by
+  *                     halRunTimers() / halAdvance()
+  *                 |-> Serial writes to stdout
+  *                 |-> EEPROM is a 4KB array that starts erased (0xFF) and
+  *                     is always ready
+  *                 |-> halPortWrite() can be traced, tools/matrixsim replays
+  *                     the display interrupt's port writes with it
+  *
+*/
+
+#ifndef HAL_H
+#define HAL_H
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+#include <avr/eeprom.h>
+
+// one core, no threads
+#define HAL_THREAD_LOCAL
+
+// a store, the host version can be traced
+inline void halPortWrite(volatile uint8_t *reg, uint8_t value){
+  *reg = value;
+}
+
+#else
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// the MEGA's clock, for code that converts cycles
+#define F_CPU 16000000UL
+
+// state that host tools may use from several threads at once
+#define HAL_THREAD_LOCAL thread_local
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define memcpy_P memcpy
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// MEGA 2560 analog pin numbers
+const uint8_t A0 = 54;
+const uint8_t A1 = 55;
+const uint8_t A2 = 56;
+const uint8_t A3 = 57;
+const uint8_t A4 = 58;
+
+const uint8_t HAL_PINS = 70;
+const uint8_t HAL_PORTS = 13; // PORTA(1) .. PORTL(12), 0 == not a port
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+uint8_t digitalPinToPort(uint8_t pin);
+uint8_t digitalPinToBitMask(uint8_t pin);
+volatile uint8_t *portOutputRegister(uint8_t port);
+volatile uint8_t *portInputRegister(uint8_t port);
+void halPortWrite(volatile uint8_t *reg, uint8_t value);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// the MEGA's 4KB EEPROM, same calls as avr/eeprom.h
+#define E2END 0xFFF
+#define eeprom_is_ready() 1
+uint8_t eeprom_read_byte(const uint8_t *addr);
+void eeprom_update_byte(uint8_t *addr, uint8_t value);
+
+class HalSerial {
+  public:
+    void begin(unsigned long baud);
+    int available();
+    int read();
+    int availableForWrite();
+    size_t write(uint8_t b);
+    size_t write(const uint8_t *buf, size_t len);
+    size_t print(const char *s);
+    size_t print(char c);
+    size_t print(int n);
+    size_t print(unsigned int n);
+    size_t print(long n);
+    size_t print(unsigned long n);
+    template<class T> size_t println(T v){ return print(v) + println(); }
+    size_t println();
+};
+extern HalSerial Serial;
+
+// host only -----------------------------------------------------------------
+// emulated timer interrupt, isr returns the microseconds until its next call
+typedef uint32_t (*HalTimerIsr)();
+void halTimer(HalTimerIsr isr);
+// fire every timer that is due on the current clock
+void halRunTimers();
+// stop following the wall clock, time then only moves with halAdvance()
+// and, if running, with the wall clock between halAdvance() calls
+void halUseSimClock(bool sim, bool running = false);
+void halAdvance(uint32_t us);
+// drive an input pin from the outside, e.g. a button (LOW == pressed)
+void halSetInput(uint8_t pin, uint8_t level);
+// bytes a host hands to Serial.read()
+void halSerialFeed(const uint8_t *buf, size_t len);
+// drop everything written to Serial instead of printing it
+void halSerialQuiet(bool quiet);
+// called after every halPortWrite(), NULL to stop
+typedef void (*HalPortTrace)(volatile uint8_t *reg, uint8_t value);
+void halTracePorts(HalPortTrace trace);
+// how late timer interrupts run, for tools/matrixsim: clock(true) as one
+// starts, clock(false) returns the ns from the timer coming due to now
+// inside it, NULL to stop
+typedef uint32_t (*HalIsrClock)(bool start);
+void halTraceIsr(HalIsrClock clock);
+// ns into the running timer interrupt, 0 when not traced
+uint32_t halIsrNs();
+// the EEPROM image, E2END + 1 bytes, and how many bytes really changed
+uint8_t *halEeprom();
+unsigned long halEepromWrites();
+
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+/*
+  *@hardware overview
+  *           pin out of the 3x3 RGB LED shield on the MEGA 2560
+  *           BOARDPINS[x][y] == {column ground, red, green, blue} of led (x,y)
+  *                 |-> an led is lit when its ground pin and a colour pin
+  *                     are both HIGH
+  *           the pin tables are in PROGMEM, so they cost no SRAM
+  *           the matrix size is -D TTT_MATRIX_ROWS / TTT_MATRIX_COLS, only
+  *           3x3 has pin tables (and bitboard.h's game) so far, a bigger
+  *           matrix stops the build here until its tables are added, the
+  *           engine for bigger boards is mnk.h
+  *
+*/
+
+#ifndef HARDWARE_H
+#define HARDWARE_H
+
+#include "hal.h"
+
+// RGB pins # corresponds to row
+#define PWM1RED     13
+#define PWM1GREEN   10
+#define PWM1BLUE    7
+#define PWM2RED     12
+#define PWM2BLUE    9
+#define PWM2GREEN   6
+#define PWM3RED     11
+#define PWM3BLUE    8
+#define PWM3GREEN   5
+
+// Column grounds
+#define ROW1GND    4
+#define ROW2GND    3
+#define ROW3GND    2
+
+// Buttons
+#define rightB     A1
+#define leftB      A3
+#define upB        A2
+#define downB      A4
+#define selectB    A0
+
+// board layout
+#ifndef TTT_MATRIX_ROWS
+#define TTT_MATRIX_ROWS 3
+#endif
+#ifndef TTT_MATRIX_COLS
+#define TTT_MATRIX_COLS 3
+#endif
+const int ROW = TTT_MATRIX_ROWS;
+const int COL = TTT_MATRIX_COLS;
+const int LEDS = ROW*COL;
+const int GNDS = COL;    // one ground per column
+const int RGB = 3;
+const int RGB_PINS = ROW*RGB;  // one per colour per row
+const int NUM_BUTTONS = 5;
+
+#if TTT_MATRIX_ROWS != 3 || TTT_MATRIX_COLS != 3
+#error "no pin tables for this matrix size, add RGBPINS, GNDPINS and BOARDPINS for it"
+#endif
+
+// pin tables live in flash, read them with the hw*() helpers below
+const uint8_t RGBPINS[RGB_PINS] PROGMEM = {13, 12, 11, 10, 9, 8, 7, 6, 5};
+const uint8_t GNDPINS[GNDS] PROGMEM = {4, 3, 2};
+
+const uint8_t BOARDPINS[ROW][COL][RGB+1] PROGMEM = {
+       {{4,13,12,11},{3,13,12,11},{2,13,12,11}},
+       {{4,10,9,8}, {3,10,9,8}, {2,10,9,8}},
+       {{4,7,6,5}, {3,7,6,5}, {2,7,6,5}}
+  };
+
+// up(0), right(1), down(2), left(3), select(4)
+const uint8_t BUTTONS[NUM_BUTTONS] PROGMEM = {A2, A0, A4, A3, A1};
+
+inline uint8_t hwRgbPin(int i){
+  return pgm_read_byte(&RGBPINS[i]);
+}
+inline uint8_t hwGndPin(int i){
+  return pgm_read_byte(&GNDPINS[i]);
+}
+inline uint8_t hwBoardPin(int x, int y, int q){
+  return pgm_read_byte(&BOARDPINS[x][y][q]);
+}
+inline uint8_t hwButtonPin(int i){
+  return pgm_read_byte(&BUTTONS[i]);
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+  *@hexapawn overview
+  *           Martin Gardner's hexapawn as an engine.h game, on the same 3x3
+  *           bit layout as bitboard.h (cell (x,y) == bit x*3 + y)
+  *           white starts on row 0 and moves to higher x, black starts on
+  *           row 2 and moves to lower x, white is the first player
+  *                 |-> a pawn steps forward onto an empty cell or
+  *                     diagonally forward onto an enemy pawn (captures)
+  *                 |-> a side wins by reaching the far row, taking every
+  *                     enemy pawn or leaving the other side without a move
+  *           no draws, with best play black wins
+  *           a move is from | direction << 4, direction 0 forward,
+  *           1 towards y - 1, 2 towards y + 1 (both captures)
+  *
+*/
+
+#ifndef HEXAPAWN_H
+#define HEXAPAWN_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+struct HexapawnState {
+  uint16_t white;     // bit set == white pawn on that cell
+  uint16_t black;
+  uint8_t whiteTurn;  // white == 1, black == 0
+  int8_t winner;      // white == 1, black == 0, none == -1
+};
+
+struct Hexapawn {
+  typedef HexapawnState State;
+  typedef uint8_t Move;
+
+  // every pawn can step at most twice and the second step wins
+  static const uint8_t MAX_PLIES = 2*BB_SIZE + 1;
+  static const Move NO_MOVE = 0xFF;
+  static const int WIN = 10;
+
+  static State start(){
+    return State{0007, 0700, 1, -1};
+  }
+
+  static uint8_t moveFrom(Move m){
+    return m & 0x0F;
+  }
+  static uint8_t moveDir(Move m){
+    return m >> 4;
+  }
+  // target cell, -1 if the move leaves the board
+  static int8_t moveTo(Move m, bool white){
+    int x = moveFrom(m) / BB_SIZE + (white ? 1 : -1);
+    int y = moveFrom(m) % BB_SIZE + (moveDir(m) == 1 ? -1 : moveDir(m) == 2 ? 1 : 0);
+    if(x < 0 || x >= BB_SIZE || y < 0 || y >= BB_SIZE)
+      return -1;
+    return bbCell(x, y);
+  }
+
+  static bool nextMove(const State &s, uint8_t &cursor, Move &m){
+    uint16_t own = s.whiteTurn ? s.white : s.black;
+    uint16_t enemy = s.whiteTurn ? s.black : s.white;
+    while(cursor < BB_CELLS*3){
+      uint8_t from = cursor / 3;
+      uint8_t dir = cursor % 3;
+      cursor++;
+      if(!(own & bbBit(from)))
+        continue;
+      Move candidate = from | dir << 4;
+      int8_t to = moveTo(candidate, s.whiteTurn);
+      if(to < 0)
+        continue;
+      uint16_t need = dir == 0 ? (uint16_t)~(own | enemy) : enemy;
+      if(need & bbBit(to)){
+        m = candidate;
+        return true;
+      }
+    }
+    return false;
+  }
+  static void make(State &s, Move m){
+    bool white = s.whiteTurn;
+    uint16_t &own = white ? s.white : s.black;
+    uint16_t &enemy = white ? s.black : s.white;
+    uint8_t to = moveTo(m, white);
+    own = (own & ~bbBit(moveFrom(m))) | bbBit(to);
+    enemy &= ~bbBit(to);
+    s.whiteTurn = !white;
+    uint8_t farRow = white ? BB_SIZE - 1 : 0;
+    uint8_t cursor = 0;
+    Move reply;
+    if(to / BB_SIZE == farRow || !enemy || !nextMove(s, cursor, reply))
+      s.winner = white;
+  }
+  // moves are undone in reverse order and never made on a finished game
+  static void unmake(State &s, Move m){
+    bool white = !s.whiteTurn;
+    uint16_t &own = white ? s.white : s.black;
+    uint16_t &enemy = white ? s.black : s.white;
+    uint8_t to = moveTo(m, white);
+    own = (own & ~bbBit(to)) | bbBit(moveFrom(m));
+    if(moveDir(m) != 0)
+      enemy |= bbBit(to);
+    s.whiteTurn = white;
+    s.winner = -1;
+  }
+  static bool terminal(const State &s){
+    return s.winner != -1;
+  }
+  static int evaluate(const State &s){
+    return s.winner == 1 ? WIN : s.winner == 0 ? -WIN : 0;
+  }
+  static bool maximising(const State &s){
+    return s.whiteTurn;
+  }
+  // small enough to search without a transposition table
+  static bool probe(const State &, int, uint8_t &, int &, Move &){
+    return false;
+  }
+  static void store(const State &, int, uint8_t, int, Move){}
+  // always searched to the end
+  static int heuristic(const State &){
+    return 0;
+  }
+  static bool book(const State &, Move &, int &){
+    return false;
+  }
+};
+
+#endif
@@ -0,0 +1,46 @@
+/*
+  *@input overview
+  *           A0 - A4 sit on PORTF, which has no pin change interrupts on the
+  *           MEGA 2560, so the buttons are sampled from the Timer0 compare A
+  *           interrupt instead (~1kHz, Timer0 keeps running millis())
+  *           every button has its own debounce state machine in the
+  *           interrupt, a steady change pushes a timestamped event into a
+  *           single producer / single consumer ring buffer
+  *           loop() drains the ring with inputPoll(), a press on a combo
+  *           button is held back up to CHORD_MS so a second press can be
+  *           handed over in the same frame (party, random and 2 player modes)
+  *
+*/
+
+#ifndef INPUT_H
+#define INPUT_H
+
+#include "hardware.h"
+
+// up(0), right(1), down(2), left(3), select(4) -> same order as BUTTONS
+const uint8_t BTN_UP = 0;
+const uint8_t BTN_RIGHT = 1;
+const uint8_t BTN_DOWN = 2;
+const uint8_t BTN_LEFT = 3;
+const uint8_t BTN_SELECT = 4;
+
+const uint8_t DEBOUNCE_SAMPLES = 5; // ~5ms of steady input
+const uint16_t CHORD_MS = 30;
+const uint8_t INPUT_QUEUE = 16;     // power of two
+
+struct ButtonEvent {
+  uint16_t time;    // millis() when the change was accepted
+  uint8_t button;
+  uint8_t pressed;  // 1 == pressed, 0 == released
+};
+
+// call once from setup() after the buttons are INPUT_PULLUP
+void inputBegin();
+// buttons pressed this frame, bit b == button b, at most one press each
+uint8_t inputPoll();
+// timestamp of the newest press handed out by inputPoll()
+uint16_t inputLastPress();
+// events lost because the ring was full
+uint8_t inputDropped();
+
+#endif
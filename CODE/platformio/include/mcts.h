@@ -0,0 +1,68 @@
+/*
+  *@mcts overview
+  *           Monte Carlo tree search (UCT) for boards too big to search
+  *           through, never touches the heap
+  *                 |-> nodes come from one fixed arena of MCTS_SRAM_BUDGET
+  *                     bytes, when it is full the search keeps playing out
+  *                     from the leaves it has
+  *                 |-> once full, a node with cells still untried plays out
+  *                     from itself even if it has children, so the tree
+  *                     stops growing there, going on down its children
+  *                     instead leaves the untried replies out of its score
+  *                     and loses far more games against perfect play
+  *                     (mctsbench)
+  *                 |-> at most 32767 visits at the root, so a score of two
+  *                     half points per visit still fits 16 bits
+  *                 |-> a playout fills the board with random moves straight
+  *                     on the bit masks
+  *                 |-> mctsBegin(board) keeps the subtree of the last search
+  *                     if board is reached from its root in one or two
+  *                     plies, the rest of the arena is compacted away
+  *           same slicing as search.h
+  *                 |-> mctsBegin(board) once
+  *                 |-> mctsStep(us) every loop() until it returns true
+  *                 |-> mctsMove() holds the answer, the most visited cell
+  *           on a host the tree is per thread (HAL_THREAD_LOCAL)
+  *
+*/
+
+#ifndef MCTS_H
+#define MCTS_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+#ifndef MCTS_SRAM_BUDGET
+#define MCTS_SRAM_BUDGET 1024
+#endif
+// playouts per move unless mctsBegin() is told otherwise
+#ifndef MCTS_PLAYOUTS
+#define MCTS_PLAYOUTS 1500
+#endif
+
+struct MctsNode {
+  uint16_t visits;
+  uint16_t score;        // half points for the side that moved here, win 2 draw 1
+  uint16_t child;        // first child, 0 == none (the root is never a child)
+  uint16_t sibling;      // next child of the same parent, 0 == none
+  uint16_t untried : 9;  // cells with no child yet, 0 on a finished game
+  uint16_t move : 4;     // cell played to get here
+};
+
+const uint16_t MCTS_NODES = MCTS_SRAM_BUDGET / sizeof(MctsNode);
+
+static_assert(sizeof(MctsNode) == 10, "MctsNode should pack into 10 bytes");
+static_assert(MCTS_NODES > BB_CELLS, "MCTS arena must hold the root and its children");
+
+void mctsSeed(uint32_t seed);
+void mctsBegin(const Board &board, uint16_t playouts = MCTS_PLAYOUTS);
+// runs for at most budgetUs microseconds, true once the playouts are done
+bool mctsStep(unsigned long budgetUs);
+bool mctsRunning();
+int mctsMove();                 // most visited cell, -1 if the game is over
+float mctsValue();              // mctsMove()'s score per visit, 0 loss to 1 win, -1 if over
+unsigned long mctsPlayouts();   // playouts of the last search
+uint16_t mctsNodesUsed();       // arena nodes in use
+uint16_t mctsNodesReused();     // nodes the last mctsBegin() kept
+
+#endif
@@ -0,0 +1,274 @@
+/*
+  *@mnk overview
+  *           m,n,k games (k in a row on an m x n board) as engine.h games,
+  *           header only, tic-tac-toe is Mnk<3, 3, 3>
+  *                 |-> Mnk<4, 4, 4>    4x4, four in a row, opens from
+  *                                     book4.h (see mnkBook4)
+  *                 |-> Mnk<5, 5, 4>    5x5, four in a row
+  *           32-bit bitboards, cell (x,y) == bit x*N + y, the same layout
+  *           as bitboard.h and book4.h, so m*n is at most 32
+  *           the winning lines are generated at compile time (MnkLines),
+  *           in bitboard.h's order: rows, columns, then both diagonals
+  *           moves are pruned by threats, see Mnk::candidates
+  *                 |-> a win in one is the only move searched
+  *                 |-> else the opponent's wins in one are the only moves
+  *                 |-> else every empty cell, centre first
+  *           heuristic() scores open lines for depth limited searches,
+  *           search them with Deepening<> (engine.h)
+  *           like searchstate.h the tables are plain constexpr, on AVR they
+  *           are copied to SRAM, 112 bytes of lines for 5x5
+  *
+*/
+
+#ifndef MNK_H
+#define MNK_H
+
+#include <stdint.h>
+
+// 4x4 opening book lookup, from the side to move, see src/mnkbook.cpp
+// result 1 win, 2 loss, 3 draw as in book4.h, false if (x, o) is not in it
+bool mnkBook4(uint32_t x, uint32_t o, uint8_t &cell, uint8_t &result, uint8_t &plies);
+
+inline uint8_t mnkCount(uint32_t mask){
+  uint8_t n = 0;
+  for(; mask; mask &= mask - 1)
+    n++;
+  return n;
+}
+
+template <uint8_t M, uint8_t N, uint8_t K>
+struct MnkLines {
+  static const uint8_t COUNT = M*(N - K + 1) + N*(M - K + 1) + 2*(M - K + 1)*(N - K + 1);
+  uint32_t mask[COUNT];
+
+  static constexpr uint32_t bit(int x, int y){
+    return (uint32_t)1 << (x*N + y);
+  }
+  // every window of K cells in a row, column or diagonal
+  constexpr MnkLines() : mask() {
+    uint8_t i = 0;
+    for(int x = 0; x < M; x++){
+      for(int y = 0; y + K <= N; y++){
+        for(int k = 0; k < K; k++)
+          mask[i] |= bit(x, y + k);
+        i++;
+      }
+    }
+    for(int y = 0; y < N; y++){
+      for(int x = 0; x + K <= M; x++){
+        for(int k = 0; k < K; k++)
+          mask[i] |= bit(x + k, y);
+        i++;
+      }
+    }
+    for(int x = 0; x + K <= M; x++){
+      for(int y = 0; y + K <= N; y++){
+        for(int k = 0; k < K; k++)
+          mask[i] |= bit(x + k, y + k);
+        i++;
+      }
+    }
+    for(int x = 0; x + K <= M; x++){
+      for(int y = K - 1; y < N; y++){
+        for(int k = 0; k < K; k++)
+          mask[i] |= bit(x + k, y - k);
+        i++;
+      }
+    }
+  }
+};
+
+// cells sorted by distance from the centre, ties by cell
+template <uint8_t M, uint8_t N>
+struct MnkOrder {
+  uint8_t cell[M*N];
+
+  static constexpr int distance(int c){
+    // doubled so the centre of an even board is a whole number
+    int dx = 2*(c / N) - (M - 1), dy = 2*(c % N) - (N - 1);
+    return (dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy);
+  }
+  constexpr MnkOrder() : cell() {
+    for(int i = 0; i < M*N; i++)
+      cell[i] = i;
+    for(int i = 1; i < M*N; i++){
+      for(int j = i; j > 0 && distance(cell[j]) < distance(cell[j - 1]); j--){
+        uint8_t t = cell[j];
+        cell[j] = cell[j - 1];
+        cell[j - 1] = t;
+      }
+    }
+  }
+};
+
+template <uint8_t M, uint8_t N, uint8_t K>
+struct Mnk {
+  static_assert(M*N <= 32, "m,n,k boards are 32-bit bitboards");
+  static_assert(K >= 2 && K <= M && K <= N, "k must fit both ways");
+
+  static const uint8_t CELLS = M*N;
+  static constexpr MnkLines<M, N, K> LINES{};
+  static constexpr MnkOrder<M, N> ORDER{};
+
+  struct State {
+    uint32_t x;       // bit set == X on that cell
+    uint32_t o;       // bit set == O on that cell
+    uint8_t empties;
+    uint8_t xTurn;    // X == 1, O == 0
+    int8_t winner;    // X == 1, O == 0, none == -1
+    // candidates() of every ply, filled in by nextMove() at cursor 0
+    mutable uint32_t moves[CELLS + 1];
+  };
+  typedef uint8_t Move;
+
+  static const uint8_t MAX_PLIES = CELLS;
+  static const Move NO_MOVE = 0xFF;
+  // open lines score 1, 4, 16.. per piece, well below a won game
+  static const int WIN = 1000;
+  static const int HEURISTIC_MAX = WIN / 2;
+
+  static constexpr uint32_t bit(uint8_t cell){
+    return (uint32_t)1 << cell;
+  }
+  static constexpr uint32_t full(){
+    return CELLS == 32 ? 0xFFFFFFFF : ((uint32_t)1 << CELLS) - 1;
+  }
+  static uint32_t empty(const State &s){
+    return full() & ~(s.x | s.o);
+  }
+
+  static int8_t winnerOf(uint32_t x, uint32_t o){
+    for(uint8_t i = 0; i < LINES.COUNT; i++){
+      if((x & LINES.mask[i]) == LINES.mask[i])
+        return 1;
+      if((o & LINES.mask[i]) == LINES.mask[i])
+        return 0;
+    }
+    return -1;
+  }
+  // mask of the first complete line, 0 if there is none
+  static uint32_t winLine(uint32_t x, uint32_t o){
+    for(uint8_t i = 0; i < LINES.COUNT; i++){
+      if((x & LINES.mask[i]) == LINES.mask[i] || (o & LINES.mask[i]) == LINES.mask[i])
+        return LINES.mask[i];
+    }
+    return 0;
+  }
+
+  static State start(uint32_t x = 0, uint32_t o = 0){
+    State s;
+    s.x = x;
+    s.o = o;
+    s.empties = mnkCount(empty(s));
+    s.xTurn = mnkCount(x) <= mnkCount(o);
+    s.winner = winnerOf(x, o);
+    return s;
+  }
+
+  // cells that complete a line of own pieces the other side has not blocked
+  static uint32_t threats(uint32_t own, uint32_t other){
+    uint32_t cells = 0;
+    for(uint8_t i = 0; i < LINES.COUNT; i++){
+      uint32_t line = LINES.mask[i];
+      if(!(line & other) && mnkCount(line & own) == K - 1)
+        cells |= line & ~own;
+    }
+    return cells;
+  }
+  static uint32_t candidates(const State &s){
+    uint32_t own = s.xTurn ? s.x : s.o;
+    uint32_t other = s.xTurn ? s.o : s.x;
+    uint32_t wins = threats(own, other);
+    if(wins)
+      return wins & (~wins + 1);  // any one of them
+    // two or more of these and the game is lost whatever is played
+    uint32_t blocks = threats(other, own);
+    if(blocks)
+      return blocks;
+    return empty(s);
+  }
+
+  static bool nextMove(const State &s, uint8_t &cursor, Move &m){
+    uint32_t &moves = s.moves[CELLS - s.empties];
+    if(cursor == 0)
+      moves = candidates(s);
+    while(cursor < CELLS){
+      uint8_t cell = ORDER.cell[cursor++];
+      if(moves & bit(cell)){
+        m = cell;
+        return true;
+      }
+    }
+    return false;
+  }
+  static void make(State &s, Move m){
+    uint32_t &own = s.xTurn ? s.x : s.o;
+    own |= bit(m);
+    s.empties--;
+    // only the lines through m can have been completed
+    for(uint8_t i = 0; i < LINES.COUNT; i++){
+      if((LINES.mask[i] & bit(m)) && (own & LINES.mask[i]) == LINES.mask[i]){
+        s.winner = s.xTurn;
+        break;
+      }
+    }
+    s.xTurn = !s.xTurn;
+  }
+  static void unmake(State &s, Move m){
+    s.xTurn = !s.xTurn;
+    (s.xTurn ? s.x : s.o) &= ~bit(m);
+    s.empties++;
+    s.winner = -1;
+  }
+  static bool terminal(const State &s){
+    return s.empties == 0 || s.winner != -1;
+  }
+  static int evaluate(const State &s){
+    return s.winner == 1 ? WIN : s.winner == 0 ? -WIN : 0;
+  }
+  // lines only one side has pieces in, worth 4x more per piece
+  static int heuristic(const State &s){
+    int value = 0;
+    for(uint8_t i = 0; i < LINES.COUNT; i++){
+      uint8_t xs = mnkCount(s.x & LINES.mask[i]);
+      uint8_t os = mnkCount(s.o & LINES.mask[i]);
+      if(xs && !os)
+        value += 1 << 2*(xs - 1);
+      else if(os && !xs)
+        value -= 1 << 2*(os - 1);
+    }
+    if(value > HEURISTIC_MAX)
+      return HEURISTIC_MAX;
+    if(value < -HEURISTIC_MAX)
+      return -HEURISTIC_MAX;
+    return value;
+  }
+  static bool maximising(const State &s){
+    return s.xTurn;
+  }
+  // no transposition table, 32-bit boards do not fit ttable.h's keys
+  static bool probe(const State &, int, uint8_t &, int &, Move &){
+    return false;
+  }
+  static void store(const State &, int, uint8_t, int, Move){}
+  // 4x4 four in a row opens from book4.h, score as the engine's
+  static bool book(const State &s, Move &m, int &score){
+    // other boards never name mnkBook4(), so they never link the book in
+    if constexpr(M == 4 && N == 4 && K == 4){
+      if(terminal(s))
+        return false;
+      uint8_t cell, result, plies;
+      if(!mnkBook4(s.x, s.o, cell, result, plies))
+        return false;
+      score = result == 1 ? WIN - plies : result == 2 ? -(WIN - plies) : 0;
+      if(!s.xTurn)
+        score = -score;
+      m = cell;
+      return true;
+    }else{
+      return false;
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,69 @@
+/*
+  *@move table overview
+  *           perfect play for every 3x3 position, solved by the compiler
+  *           index == base 3 number of the board, cell c is digit c
+  *                 |-> empty == 0, X == 1, O == 2
+  *           each entry is one byte in PROGMEM
+  *                 |-> low nibble  == best cell (0-8), MT_NO_MOVE if game over
+  *                 |-> high nibble == result for the side to move
+  *                       0     -> draw
+  *                       1..5  -> win in 2n-1 plies (1,3,5,7,9)
+  *                       8..12 -> loss in 2(n-8) plies (0,2,4,6,8)
+  *
+*/
+
+#ifndef MOVETABLE_H
+#define MOVETABLE_H
+
+#include <stdint.h>
+#include "hal.h"
+#include "bitboard.h"
+
+const uint16_t MT_POSITIONS = 19683; // 3^9
+const uint8_t MT_NO_MOVE = 0x0F;
+const uint8_t MT_DRAW = 0x0;
+const uint8_t MT_WIN = 0x1;
+const uint8_t MT_LOSS = 0x8;
+
+struct MoveTable {
+  uint8_t entry[MT_POSITIONS];
+};
+extern const MoveTable MOVE_TABLE PROGMEM;
+
+constexpr uint16_t MT_POW3[BB_CELLS] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};
+
+inline uint16_t mtIndex(const Board &b){
+  uint16_t idx = 0;
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    if(b.x & bbBit(cell)){
+      idx += MT_POW3[cell];
+    }else if(b.o & bbBit(cell)){
+      idx += 2*MT_POW3[cell];
+    }
+  }
+  return idx;
+}
+inline uint8_t mtLookup(const Board &b){
+  return pgm_read_byte(&MOVE_TABLE.entry[mtIndex(b)]);
+}
+
+constexpr uint8_t mtMove(uint8_t e){
+  return e & 0x0F;
+}
+constexpr uint8_t mtResult(uint8_t e){
+  return e >> 4;
+}
+// plies until the game is decided, draws are not tracked
+constexpr uint8_t mtDistance(uint8_t e){
+  return mtResult(e) >= MT_LOSS ? 2*(mtResult(e) - MT_LOSS)
+       : mtResult(e) != MT_DRAW ? 2*mtResult(e) - 1
+       : 0;
+}
+// same scale as utility(), 10 minus the distance to the win
+constexpr int mtScore(uint8_t e){
+  return mtResult(e) >= MT_LOSS ? -10 + mtDistance(e)
+       : mtResult(e) != MT_DRAW ? 10 - mtDistance(e)
+       : 0;
+}
+
+#endif
@@ -0,0 +1,76 @@
+/*
+  *@profile overview
+  *           optional hot path counters, build with -D TTT_PROFILE
+  *           without it every call below is an empty inline and compiles out
+  *           time is counted in CPU cycles from a free running Timer5 (clk/1)
+  *           whose overflow interrupt extends it to 32 bits (~268s)
+  *                 |-> search    cycles and nodes per AI move
+  *                 |-> draw      drawBoard() frame builds
+  *                 |-> isr       display interrupt, shows its real CPU share
+  *                 |-> frame     loop() time, plus a log2 histogram in us
+  *                 |-> latency   button press to the frame that shows it, ms
+  *           a PROTO_PROFILE frame gets a ProfileDump back (see protocol.h),
+  *           the counters restart after every dump
+  *
+*/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+
+const uint8_t PROF_VERSION = 1;
+const uint8_t PROF_HIST_BINS = 16; // bin b counts frames of 2^(b-1) to 2^b us
+
+struct ProfStat {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint32_t total;
+};
+
+// body of a PROTO_PROFILE_REPLY, sent as is since the MEGA and x86 are
+// both little endian
+struct ProfileDump {
+  uint8_t magic[2];   // 'T' 'P'
+  uint8_t version;
+  uint8_t size;       // sizeof(ProfileDump)
+  ProfStat search;    // cycles
+  uint32_t searchNodes;
+  uint32_t searchNodesMax;
+  ProfStat draw;      // cycles
+  ProfStat isr;       // cycles
+  ProfStat frame;     // cycles
+  uint16_t frameHist[PROF_HIST_BINS];
+  ProfStat latency;   // ms
+};
+
+#ifdef TTT_PROFILE
+
+void profBegin();
+uint32_t profCycles();
+void profSearch(uint32_t cycles, uint32_t nodes);
+void profDraw(uint32_t cycles);
+void profIsr(uint32_t cycles);
+void profFrame(uint32_t cycles);
+// a press (millis() stamp) reached the game / the frame it caused went out
+void profPress(uint16_t pressTime);
+void profShown();
+// copy the counters out and restart them, false if profiling is off
+bool profSnapshot(ProfileDump &out);
+
+#else
+
+inline void profBegin(){}
+inline uint32_t profCycles(){ return 0; }
+inline void profSearch(uint32_t, uint32_t){}
+inline void profDraw(uint32_t){}
+inline void profIsr(uint32_t){}
+inline void profFrame(uint32_t){}
+inline void profPress(uint16_t){}
+inline void profShown(){}
+inline bool profSnapshot(ProfileDump &){ return false; }
+
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+/*
+  *@protocol overview
+  *           binary Serial link so a host can use the game's AI to evaluate
+  *           positions in bulk, also carries the profiling dump and log text
+  *           every frame on the wire is
+  *                 0x00  COBS(type, seq, body..., crc lo, crc hi)  0x00
+  *                 |-> COBS removes every zero, so 0x00 only ever marks a
+  *                     frame edge and a receiver can resync on any byte
+  *                 |-> crc == CRC-16/CCITT-FALSE (0x1021, init 0xFFFF) over
+  *                     type, seq and body
+  *                 |-> seq is chosen by the host and echoed in every reply
+  *           messages (host -> device / device -> host)
+  *                 PROTO_EVAL      count, count x 3 byte positions
+  *                                 position == x mask | o mask << 9, little endian
+  *                 PROTO_EVAL_REPLY  first, count, count x (move, score)
+  *                                 move 0-8 or PROTO_NO_MOVE, score int8 on the
+  *                                 utility() scale (X wins > 0)
+  *                                 long batches come back in several replies
+  *                 PROTO_PROFILE   no body -> PROTO_PROFILE_REPLY ProfileDump
+  *                 PROTO_STATS     no body -> PROTO_STATS_REPLY, GlogTotals up
+  *                                 to crc (laps, then win/draw/loss per mode)
+  *                 PROTO_GAMES     back (uint16), count -> PROTO_GAMES_REPLY
+  *                                 back, count, count x 4 byte game records
+  *                                 newest first, see gamelog.h
+  *                 PROTO_LOG       device text, replaces the old Serial.print
+  *                 PROTO_NAK       error code, see below
+  *           one batch at a time, the host waits for the last reply before
+  *           sending the next batch (a new batch while busy gets a NAK)
+  *           nothing here blocks, bytes move through ring buffers from loop()
+  *
+*/
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <stdint.h>
+
+// 16MHz / (8 * 4) -> 0% baud error with the double speed UART
+const unsigned long PROTO_BAUD = 500000;
+
+const uint8_t PROTO_MAX_BATCH = 64;    // positions per PROTO_EVAL
+const uint8_t PROTO_REPLY_CHUNK = 16;  // results per PROTO_EVAL_REPLY
+const uint8_t PROTO_MAX_PAYLOAD = 200; // decoded type..crc, fits a full batch
+const uint8_t PROTO_TX_BUFFER = 255;   // ring, holds a profile reply
+const uint8_t PROTO_NO_MOVE = 0xFF;
+const uint8_t PROTO_MAX_GAMES = 32;    // records per PROTO_GAMES_REPLY
+
+// message types, replies have the top bit set
+const uint8_t PROTO_EVAL = 0x01;
+const uint8_t PROTO_PROFILE = 0x02;
+const uint8_t PROTO_STATS = 0x03;
+const uint8_t PROTO_GAMES = 0x04;
+const uint8_t PROTO_EVAL_REPLY = 0x81;
+const uint8_t PROTO_PROFILE_REPLY = 0x82;
+const uint8_t PROTO_LOG = 0x83;
+const uint8_t PROTO_STATS_REPLY = 0x84;
+const uint8_t PROTO_GAMES_REPLY = 0x85;
+const uint8_t PROTO_NAK = 0xFF;
+
+// NAK codes
+const uint8_t PROTO_ERR_CRC = 1;     // bad crc or COBS, seq is 0
+const uint8_t PROTO_ERR_LENGTH = 2;  // frame too long or body size wrong
+const uint8_t PROTO_ERR_TYPE = 3;    // unknown message type
+const uint8_t PROTO_ERR_BUSY = 4;    // still answering the last batch
+
+void protoBegin();
+// call every loop(), reads, evaluates a few positions and writes
+void protoPoll();
+// best effort text, dropped if the tx buffer is full
+void protoLog(const char *msg);
+
+uint16_t protoCrc(uint16_t crc, uint8_t data);
+
+#endif
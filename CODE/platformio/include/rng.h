@@ -0,0 +1,33 @@
+/*
+  *@rng overview
+  *           small seedable random numbers (xorshift32)
+  *           every user keeps its own Rng, so the game, the host tools and
+  *           each of their threads get repeatable sequences from a seed
+  *           instead of sharing the Arduino random() state
+  *
+*/
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+struct Rng {
+  uint32_t state; // never 0, xorshift would stay there
+};
+
+inline void rngSeed(Rng &rng, uint32_t seed){
+  rng.state = seed ? seed : 0x9E3779B9;
+}
+inline uint32_t rngNext(Rng &rng){
+  rng.state ^= rng.state << 13;
+  rng.state ^= rng.state >> 17;
+  rng.state ^= rng.state << 5;
+  return rng.state;
+}
+// 0 .. n-1, n > 0
+inline uint8_t rngBelow(Rng &rng, uint8_t n){
+  return (uint8_t)(rngNext(rng) % n);
+}
+
+#endif
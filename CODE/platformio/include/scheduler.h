@@ -0,0 +1,52 @@
+/*
+  *@scheduler overview
+  *           cooperative fixed tick scheduler, loop() only calls schedRun()
+  *           every task has a period and a uint32_t micros() deadline,
+  *           deadlines are compared with schedDue() so they survive the
+  *           71 minute micros() wrap
+  *                 |-> due tasks run in the order they were added, so the
+  *                     first one has the shortest latency
+  *                 |-> the next deadline is the last one plus the period, no
+  *                     drift from how long a pass took
+  *                 |-> a task that is already past its next deadline when it
+  *                     finishes (started late, ran long or both) is an
+  *                     overrun, it is counted and the missed runs are
+  *                     dropped instead of run back to back
+  *           worst start delay and run time per task are kept for the
+  *           telemetry task, schedClear() restarts them
+  *
+*/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+const uint8_t SCHED_MAX_TASKS = 5;
+
+typedef void (*SchedFn)();
+
+struct SchedTask {
+  uint32_t period;    // us
+  uint32_t due;       // micros() of the next run
+  uint16_t maxLate;   // worst start after the deadline, us (saturates)
+  uint16_t maxRun;    // worst run time, us (saturates)
+  uint16_t overruns;
+};
+
+// true once now has reached deadline, across the wrap as long as the two
+// are less than 2^31 us (35 minutes) apart
+inline bool schedDue(uint32_t now, uint32_t deadline){
+  return (int32_t)(now - deadline) >= 0;
+}
+
+// first run offsetUs from now, returns the task id
+uint8_t schedAdd(const char *name, SchedFn run, uint32_t periodUs, uint32_t offsetUs = 0);
+// runs every task that is due once, returns how many ran
+uint8_t schedRun();
+uint8_t schedCount();
+const SchedTask &schedTask(uint8_t id);
+const char *schedName(uint8_t id);
+void schedClear();
+
+#endif
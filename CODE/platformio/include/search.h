@@ -0,0 +1,62 @@
+/*
+  *@search overview
+  *           negamax with principal variation search, without recursion
+  *           every ply lives in a fixed SearchFrame stack, so the search can
+  *           stop after a time budget and carry on from the next loop()
+  *                 |-> searchBegin(board, depth) once
+  *                 |-> searchStep(us) every loop() until it returns true
+  *                 |-> searchMove() / searchScore() hold the answer
+  *           moves are tried transposition table move first, then the two
+  *           killer moves of the ply, then centre, corners and edges
+  *           the first move gets the full window, the rest a null window
+  *           and a second look only if they beat it
+  *           scores are 10 minus the plies to the win, windows are narrowed
+  *           to what is still reachable from the node (mate distance)
+  *           a depth below SEARCH_FULL stops there and calls the position a
+  *           draw, that is how the easier AI levels are made, they skip the
+  *           transposition table since their scores are not exact
+  *           the stack can never be deeper than one frame per empty cell
+  *           plus the root, that is the worst case SRAM use
+  *
+*/
+
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include <stdint.h>
+#include "hal.h"
+#include "bitboard.h"
+
+const uint8_t SEARCH_STACK = BB_CELLS + 1;
+const uint8_t SEARCH_FULL = BB_CELLS;  // depth that always reaches the end
+const int SEARCH_INF = 30000;
+const int SEARCH_WIN = 10;             // utility() of a won game
+// centre, corners, edges -> the cells on the most lines first, tictactoe.h
+// tries them in the same order
+const uint8_t SEARCH_ORDER[BB_CELLS] PROGMEM = {4, 0, 2, 6, 8, 1, 3, 5, 7};
+
+struct SearchFrame {
+  int16_t alpha;
+  int16_t beta;
+  int16_t alphaStart; // alpha after mate distance pruning, for the TT bound
+  uint16_t tried;     // cells searched below this frame
+  int8_t best;        // best cell so far, -1 == none
+  int8_t hashMove;    // transposition table move, -1 == none
+  int8_t current;     // cell being searched below this frame, -1 == none
+  uint8_t next : 4;   // next move ordering stage
+  uint8_t scout : 1;  // current is searched with a null window
+};
+
+void searchBegin(const Board &board, uint8_t depth = SEARCH_FULL);
+// runs for at most budgetUs microseconds, true once the search is done
+bool searchStep(unsigned long budgetUs);
+bool searchRunning();
+// board and depth of the last searchBegin(), the game and the serial
+// protocol share the one search and use them to tell whose it is
+Board searchRoot();
+uint8_t searchLimit();
+int searchMove();   // best cell, -1 if the game is over
+int searchScore();  // utility() scale, X wins > 0, quicker wins score higher
+unsigned long searchNodes(); // nodes visited by the last search
+
+#endif
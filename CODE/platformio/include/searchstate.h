@@ -0,0 +1,91 @@
+/*
+  *@search state overview
+  *           board plus running counters kept up to date by make/unmake
+  *                 |-> pieces per side on each of the 8 lines
+  *                 |-> empty cells, side to move and winner
+  *           so the search never has to rescan the board at a node
+  *           unmake assumes moves are undone in reverse order and that no
+  *           move is ever made on a finished game
+  *
+*/
+
+#ifndef SEARCHSTATE_H
+#define SEARCHSTATE_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+const uint8_t MAX_CELL_LINES = 4; // the centre is on 4 lines
+
+struct CellLines {
+  uint8_t count;
+  uint8_t line[MAX_CELL_LINES];
+};
+struct CellLineTable {
+  CellLines cell[BB_CELLS];
+};
+
+constexpr CellLineTable buildCellLines(){
+  CellLineTable t{};
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    for(uint8_t l = 0; l < BB_NUM_LINES; l++){
+      if(BB_LINES[l] & bbBit(cell)){
+        t.cell[cell].line[t.cell[cell].count++] = l;
+      }
+    }
+  }
+  return t;
+}
+// cell -> lines through it
+constexpr CellLineTable CELL_LINES = buildCellLines();
+
+struct SearchState {
+  Board board;
+  uint8_t lineCount[2][BB_NUM_LINES]; // [O == 0, X == 1][line]
+  uint8_t empties;
+  uint8_t xTurn;  // X == 1, O == 0
+  int8_t winner;  // X == 1, O == 0, none == -1
+};
+
+inline void ssInit(SearchState &s, const Board &b){
+  s.board = b;
+  s.empties = bbCount(bbEmpty(b));
+  s.xTurn = bbXTurn(b);
+  s.winner = -1;
+  for(uint8_t l = 0; l < BB_NUM_LINES; l++){
+    s.lineCount[1][l] = bbCount(b.x & BB_LINES[l]);
+    s.lineCount[0][l] = bbCount(b.o & BB_LINES[l]);
+    if(s.lineCount[1][l] == BB_SIZE)
+      s.winner = 1;
+    else if(s.lineCount[0][l] == BB_SIZE && s.winner == -1)
+      s.winner = 0;
+  }
+}
+
+inline void ssMake(SearchState &s, uint8_t cell){
+  uint8_t side = s.xTurn;
+  uint8_t *count = s.lineCount[side];
+  const CellLines &lines = CELL_LINES.cell[cell];
+  bbPlace(s.board, cell, side);
+  for(uint8_t i = 0; i < lines.count; i++){
+    if(++count[lines.line[i]] == BB_SIZE)
+      s.winner = side;
+  }
+  s.empties--;
+  s.xTurn = !side;
+}
+
+inline void ssUnmake(SearchState &s, uint8_t cell){
+  uint8_t side = !s.xTurn;
+  uint8_t *count = s.lineCount[side];
+  const CellLines &lines = CELL_LINES.cell[cell];
+  bbClear(s.board, cell);
+  for(uint8_t i = 0; i < lines.count; i++){
+    count[lines.line[i]]--;
+  }
+  s.empties++;
+  s.xTurn = side;
+  s.winner = -1;
+}
+
+#endif
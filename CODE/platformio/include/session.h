@@ -0,0 +1,58 @@
+/*
+  *@session overview
+  *           one game, its rules and the AI that plays in it, without LEDs
+  *           or buttons, so the same code runs on the board (GameState holds
+  *           one) and in tools/server, which holds tens of thousands
+  *                 |-> sessionBegin()    when a game starts
+  *                 |-> sessionPlay()     every move, the human's or the AI's
+  *                 |-> sessionAiStep()   while sessionAiToMove(), until it
+  *                                       hands back the AI's cell
+  *           the search and MCTS behind the AI are shared (search.h, mcts.h),
+  *           so only one session may be part way through an AI move at a
+  *           time, the board has one, the server runs each move to the end
+  *
+*/
+
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <stdint.h>
+#include "bitboard.h"
+#include "rng.h"
+
+// who plays the AI side, up + down on the start screen cycles through them
+const uint8_t AI_SMART = 0;   // perfect play, move table or search
+const uint8_t AI_RANDOM = 1;  // any empty cell
+const uint8_t AI_MCTS = 2;    // Monte Carlo tree search, see mcts.h
+const uint8_t AI_EASY = 3;    // depth limited search, see search.h
+const uint8_t AI_MEDIUM = 4;
+const uint8_t AI_MODES = 5;
+
+struct GameSession {
+  Board board;            // X/O bit masks, see bitboard.h
+  Rng rng;                // AI_RANDOM moves
+  int8_t winner;          // utility() once the game is over, 0 before
+  uint8_t aiMode : 3;     // AI_SMART .. AI_MEDIUM
+  uint8_t twoPlayer : 1;  // no AI, X and O are both human
+  uint8_t aiX : 1;        // the AI plays X (and so moves first)
+  uint8_t over : 1;
+};
+
+// empty board, keeps the Rng
+void sessionBegin(GameSession &s, uint8_t aiMode, bool twoPlayer, bool aiX);
+// the side to move takes cell, false (and nothing changes) if it can't
+bool sessionPlay(GameSession &s, uint8_t cell);
+bool sessionAiToMove(const GameSession &s);
+// runs the AI for at most budgetUs microseconds, true with its cell once the
+// move is ready, UINT32_MAX runs it to the end
+bool sessionAiStep(GameSession &s, unsigned long budgetUs, int &cell);
+// nodes or playouts behind the last AI move, 0 for table and random moves
+unsigned long sessionAiNodes(const GameSession &s);
+
+// rules, X == 1, O == 0
+int checkWinner(const Board &board);
+int utility(const Board &board);
+bool terminal(const Board &board);
+int userTurn(const Board &board);
+
+#endif
@@ -0,0 +1,88 @@
+/*
+  *@tictactoe overview
+  *           tic-tac-toe as an engine.h game, X is the first player
+  *           the state is SearchState (searchstate.h) and the transposition
+  *           table is ttable.h, scores go in and out of it from the side to
+  *           move like search.cpp's, so the two can share it
+  *           moves are cells, tried in search.h's SEARCH_ORDER after the
+  *           engine's transposition table move, see tools/enginebench for
+  *           how it does against the hand written search
+  *
+*/
+
+#ifndef TICTACTOE_H
+#define TICTACTOE_H
+
+#include <stdint.h>
+#include "bitboard.h"
+#include "searchstate.h"
+#include "search.h"
+#include "ttable.h"
+
+struct TicTacToe {
+  typedef SearchState State;
+  typedef uint8_t Move;
+
+  static const uint8_t MAX_PLIES = BB_CELLS;
+  static const Move NO_MOVE = 0xFF;
+  static const int WIN = 10;  // utility() scale
+
+  static bool nextMove(const State &s, uint8_t &cursor, Move &m){
+    uint16_t empty = bbEmpty(s.board);
+    while(cursor < BB_CELLS){
+      uint8_t cell = pgm_read_byte(&SEARCH_ORDER[cursor++]);
+      if(empty & bbBit(cell)){
+        m = cell;
+        return true;
+      }
+    }
+    return false;
+  }
+  static void make(State &s, Move m){
+    ssMake(s, m);
+  }
+  static void unmake(State &s, Move m){
+    ssUnmake(s, m);
+  }
+  static bool terminal(const State &s){
+    return s.empties == 0 || s.winner != -1;
+  }
+  static int evaluate(const State &s){
+    return s.winner == 1 ? WIN : s.winner == 0 ? -WIN : 0;
+  }
+  static bool maximising(const State &s){
+    return s.xTurn;
+  }
+  // the engine scores from X, the table from the side to move
+  static uint8_t flipBound(uint8_t bound){
+    return bound == TT_LOWER ? TT_UPPER : bound == TT_UPPER ? TT_LOWER : bound;
+  }
+  static bool probe(const State &s, int depth, uint8_t &bound, int &value, Move &m){
+    uint8_t cell;
+    if(!ttProbe(s.board, depth, bound, value, cell))
+      return false;
+    if(!s.xTurn){
+      value = -value;
+      bound = flipBound(bound);
+    }
+    m = cell < BB_CELLS ? cell : NO_MOVE;
+    return true;
+  }
+  static void store(const State &s, int depth, uint8_t bound, int value, Move m){
+    if(!s.xTurn){
+      value = -value;
+      bound = flipBound(bound);
+    }
+    ttStore(s.board, depth, bound, value, m < BB_CELLS ? m : BB_CELLS);
+  }
+  // a cut off position is a draw as far as search.cpp's limits go
+  static int heuristic(const State &){
+    return 0;
+  }
+  // the move table is the book, ai.cpp reads it directly
+  static bool book(const State &, Move &, int &){
+    return false;
+  }
+};
+
+#endif
@@ -0,0 +1,49 @@
+/*
+  *@transposition table overview
+  *           caches search results keyed by the canonical board, values
+  *           are from the side to move (negamax)
+  *                 |-> rotated and mirrored boards share one entry
+  *           4 bytes per entry, the table uses TT_SRAM_BUDGET bytes at most
+  *           values are stored relative to the node (see ttStore) so an
+  *           entry stays valid between searches started at different depths
+  *           build with -D TTT_NO_TT to search without it
+  *
+*/
+
+#ifndef TTABLE_H
+#define TTABLE_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+#ifndef TT_SRAM_BUDGET
+#define TT_SRAM_BUDGET 1024
+#endif
+
+const uint8_t TT_EXACT = 1;
+const uint8_t TT_LOWER = 2; // value >= stored value
+const uint8_t TT_UPPER = 3; // value <= stored value
+
+struct TTEntry {
+  uint16_t key;       // canonical x | low 7 bits of canonical o
+  uint8_t keyHi : 2;  // top 2 bits of canonical o
+  uint8_t bound : 2;  // 0 == empty slot
+  uint8_t move  : 4;  // best cell in canonical orientation
+  int8_t value;
+};
+
+// largest power of two that fits in the budget
+constexpr uint16_t ttEntries(uint16_t maxEntries){
+  return maxEntries < 2 ? 1 : 2*ttEntries(maxEntries/2);
+}
+const uint16_t TT_ENTRIES = ttEntries(TT_SRAM_BUDGET / sizeof(TTEntry));
+
+static_assert(sizeof(TTEntry) == 4, "TTEntry should pack into 4 bytes");
+static_assert(TT_ENTRIES * sizeof(TTEntry) <= TT_SRAM_BUDGET, "transposition table over budget");
+
+void ttClear();
+// true on a hit, move is returned in the orientation of board
+bool ttProbe(const Board &board, int depth, uint8_t &bound, int &value, uint8_t &move);
+void ttStore(const Board &board, int depth, uint8_t bound, int value, uint8_t move);
+
+#endif
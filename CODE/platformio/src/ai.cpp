@@ -0,0 +1,35 @@
+#include "hal.h"
+#include "ai.h"
+#include "movetable.h"
+#include "search.h"
+
+int aiBestMove(const Board &board, int &score){
+#ifdef TTT_RUNTIME_SEARCH
+  searchBegin(board);
+  while(!searchStep(UINT32_MAX)){
+  }
+  score = searchScore();
+  return searchMove();
+#else
+  // perfect play is precomputed, see movetable.h
+  uint8_t e = mtLookup(board);
+  score = bbXTurn(board) ? mtScore(e) : -mtScore(e);
+  return mtMove(e) < BB_CELLS ? mtMove(e) : -1;
+#endif
+}
+int aiBestMove(const Board &board){
+  int score;
+  return aiBestMove(board, score);
+}
+
+int aiRandomMove(const Board &board, Rng &rng){
+  uint16_t empty = bbEmpty(board);
+  if(!empty)
+    return -1;
+  uint8_t pick = rngBelow(rng, bbCount(empty));
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    if((empty & bbBit(cell)) && pick-- == 0)
+      return cell;
+  }
+  return -1;
+}
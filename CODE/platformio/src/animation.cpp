@@ -0,0 +1,155 @@
+#include "hal.h"
+#include "animation.h"
+#include "budget.h"
+#include "rng.h"
+
+// ticks of ANIM_TICK_US
+const uint8_t ANIM_BLINK = 25;  // 500ms, the old blinkSpeed*2
+const uint8_t ANIM_CHASE = 6;
+
+#define ANIM_CELL(x, y) (1 << ((x)*3 + (y)))
+// attract mode step, X's colour on head with O's colour on the cell behind
+#define ANIM_STEP(head, tail) {ANIM_ALL, ANIM_OFF, 0}, {head, ANIM_X, 0}, {tail, ANIM_O, ANIM_CHASE}
+
+const AnimFrame ANIM_WIN[] PROGMEM = {
+  {ANIM_WIN_LINE, ANIM_WINNER, ANIM_BLINK},
+  {ANIM_WIN_LINE, ANIM_OFF, ANIM_BLINK},
+  {0, ANIM_JUMP, 0},
+};
+
+const AnimFrame ANIM_CATS_GAME[] PROGMEM = {
+  {ANIM_ALL, ANIM_BOARD, ANIM_BLINK}, {ANIM_ALL, ANIM_OFF, ANIM_BLINK},
+  {ANIM_ALL, ANIM_BOARD, ANIM_BLINK}, {ANIM_ALL, ANIM_OFF, ANIM_BLINK},
+  {ANIM_ALL, ANIM_BOARD, ANIM_BLINK}, {ANIM_ALL, ANIM_OFF, ANIM_BLINK},
+  {ANIM_ALL, ANIM_BOARD, ANIM_BLINK}, {ANIM_ALL, ANIM_OFF, ANIM_BLINK},
+  {ANIM_ALL, ANIM_BOARD, ANIM_BLINK}, {ANIM_ALL, ANIM_OFF, ANIM_BLINK},
+  {ANIM_ALL, ANIM_BOARD, ANIM_BLINK}, {ANIM_ALL, ANIM_OFF, ANIM_BLINK},
+  // 12 -> shimmer forever
+  {ANIM_ALL, ANIM_RANDOM_XO, ANIM_BLINK},
+  {0, ANIM_JUMP, 12},
+};
+
+const AnimFrame ANIM_PARTY[] PROGMEM = {
+  {ANIM_ALL, ANIM_RANDOM, ANIM_BLINK},
+  {0, ANIM_JUMP, 0},
+};
+
+// around the edge clockwise from (0,0)
+const AnimFrame ANIM_ATTRACT[] PROGMEM = {
+  ANIM_STEP(ANIM_CELL(0,0), ANIM_CELL(1,0)),
+  ANIM_STEP(ANIM_CELL(0,1), ANIM_CELL(0,0)),
+  ANIM_STEP(ANIM_CELL(0,2), ANIM_CELL(0,1)),
+  ANIM_STEP(ANIM_CELL(1,2), ANIM_CELL(0,2)),
+  ANIM_STEP(ANIM_CELL(2,2), ANIM_CELL(1,2)),
+  ANIM_STEP(ANIM_CELL(2,1), ANIM_CELL(2,2)),
+  ANIM_STEP(ANIM_CELL(2,0), ANIM_CELL(2,1)),
+  ANIM_STEP(ANIM_CELL(1,0), ANIM_CELL(2,0)),
+  {0, ANIM_JUMP, 0},
+};
+
+struct AnimState {
+  AnimContext ctx;
+  Rng rng;
+  uint8_t next;          // keyframe animTick() applies next
+  uint8_t wait;          // ticks left of the current hold
+  uint8_t paletteSize;
+};
+
+// PROGMEM pointers, kept out of AnimState like the scheduler's
+const AnimFrame *animSeq;  // NULL == nothing playing
+const uint8_t (*animPaletteTable)[RGB];
+AnimState anim;
+static_assert(sizeof(AnimState) <= BUDGET_ANIM, "animation is over its SRAM budget, see budget.h");
+
+static LedColor animPalette(uint8_t index){
+  LedColor c;
+  c.r = pgm_read_byte(&animPaletteTable[index][0]);
+  c.g = pgm_read_byte(&animPaletteTable[index][1]);
+  c.b = pgm_read_byte(&animPaletteTable[index][2]);
+  c.on = 1;
+  return c;
+}
+
+static LedColor animColor(uint8_t color, uint16_t bit){
+  switch(color){
+    case ANIM_OFF:
+      return LedColor{};
+    case ANIM_X:
+      return anim.ctx.x;
+    case ANIM_O:
+      return anim.ctx.o;
+    case ANIM_WINNER:
+      return anim.ctx.winner;
+    case ANIM_BOARD:
+      return (anim.ctx.xCells & bit) ? anim.ctx.x : anim.ctx.o;
+    case ANIM_RANDOM:
+      return animPalette(rngBelow(anim.rng, anim.paletteSize));
+    case ANIM_RANDOM_XO:
+      return (rngNext(anim.rng) & 1) ? anim.ctx.x : anim.ctx.o;
+    default:
+      return animPalette(color);
+  }
+}
+
+static void animApply(const AnimFrame &f, LedColor color[ROW][COL]){
+  uint16_t cells = f.cells == ANIM_WIN_LINE ? anim.ctx.winLine : f.cells;
+  for(uint8_t x = 0; x < ROW; x++){
+    for(uint8_t y = 0; y < COL; y++){
+      uint16_t bit = 1 << (x*COL + y);
+      if(cells & bit)
+        color[x][y] = animColor(f.color, bit);
+    }
+  }
+}
+
+void animSeed(uint32_t seed){
+  rngSeed(anim.rng, seed);
+}
+
+void animBegin(const uint8_t (*palette)[RGB], uint8_t size){
+  animPaletteTable = palette;
+  anim.paletteSize = size;
+}
+
+void animPlay(const AnimFrame *seq, const AnimContext &ctx){
+  if(!anim.rng.state)
+    rngSeed(anim.rng, 0);
+  animSeq = seq;
+  anim.ctx = ctx;
+  anim.next = 0;
+  anim.wait = 0;
+}
+
+void animStop(){
+  animSeq = NULL;
+}
+
+bool animPlaying(){
+  return animSeq != NULL;
+}
+
+bool animTick(LedColor color[ROW][COL]){
+  if(!animSeq)
+    return false;
+  if(anim.wait){
+    anim.wait--;
+    return false;
+  }
+  bool painted = false;
+  for(uint8_t chain = 0; chain < ANIM_MAX_CHAIN; chain++){
+    AnimFrame f;
+    memcpy_P(&f, &animSeq[anim.next], sizeof(f));
+    if(f.color == ANIM_JUMP){
+      anim.next = f.hold;
+      continue;
+    }
+    animApply(f, color);
+    painted = true;
+    anim.next++;
+    if(f.hold){
+      anim.wait = f.hold - 1;
+      break;
+    }
+  }
+  return painted;
+}
@@ -0,0 +1,226 @@
+#include "display.h"
+#include "budget.h"
+#include "profile.h"
+#ifdef ARDUINO
+#include <util/atomic.h>
+#endif
+
+// level -> duty, roughly (level / 15)^2.2 * 63 so steps look even to the eye
+const uint8_t GAMMA[LED_MAX+1] PROGMEM = {
+        0, 1, 1, 2, 3, 6, 8, 12, 16, 20, 26, 32, 39, 46, 54, 63
+  };
+
+struct DisplayFrame {
+  uint8_t bits[GNDS][DISPLAY_BCM_BITS][DISPLAY_MAX_PORTS]; // PORTx value per column and plane
+};
+
+// ports the shield is wired to and which of their bits belong to us
+volatile uint8_t *displayPort[DISPLAY_MAX_PORTS];
+uint8_t displayMask[DISPLAY_MAX_PORTS];
+uint8_t displayGndMask[DISPLAY_MAX_PORTS];
+uint8_t displayPorts;
+
+DisplayFrame displayFrames[2];
+LedColor displayLast[ROW][COL];  // leds of the last frame published
+volatile uint8_t displayFront;   // frame the interrupt is reading, it swaps it
+volatile uint8_t displayPending; // the back frame is whole and newer
+uint8_t displayColumn;           // only touched by the interrupt
+uint8_t displayPlane;
+static_assert(sizeof(displayFrames) + sizeof(displayLast) + sizeof(displayMask) + sizeof(displayGndMask)
+              <= BUDGET_DISPLAY, "display is over its SRAM budget, see budget.h");
+
+#ifdef ARDUINO
+// Timer1 in CTC mode, clearing TCNT1 blocks a compare in the next tick, so
+// a restarted plane needs at least 2 ticks to its match
+static_assert(DISPLAY_BCM_BASE_TICKS >= 3, "the shortest plane must outlast a TCNT1 write");
+
+static inline void displayCompare(uint16_t ticks){
+  // the count restarted at this match, so the next one is the plane length
+  OCR1A = ticks - 1;
+}
+static inline bool displayMissed(){
+  return TCNT1 >= OCR1A;
+}
+static inline void displayRestart(){
+  TCNT1 = 0;
+  TIFR1 = 1 << OCF1A;
+}
+#else
+// Timer1 on the host: halIsrNs() is how far into the interrupt the
+// hardware would be (tools/matrixsim delays it), the count restarted at
+// the match, or when displayRestart() cleared it
+const uint32_t DISPLAY_TICK_NS = DISPLAY_TICK_US * 1000UL;
+uint16_t displayOcr;
+uint32_t displayClearedNs;  // since the match
+bool displayLost;           // OCR1A was written behind the count
+
+static inline void displayCompare(uint16_t ticks){
+  displayOcr = ticks - 1;
+  displayLost = (halIsrNs() - displayClearedNs) / DISPLAY_TICK_NS >= displayOcr;
+}
+static inline bool displayMissed(){
+  return (halIsrNs() - displayClearedNs) / DISPLAY_TICK_NS >= displayOcr;
+}
+static inline void displayRestart(){
+  displayClearedNs = halIsrNs();
+  displayLost = false;
+}
+static uint32_t displayTimer();
+#endif
+
+static uint8_t displayPortIdx(uint8_t pin){
+  volatile uint8_t *reg = portOutputRegister(digitalPinToPort(pin));
+  for(uint8_t p = 0; p < displayPorts; p++){
+    if(displayPort[p] == reg)
+      return p;
+  }
+  displayPort[displayPorts] = reg;
+  return displayPorts++;
+}
+
+void displayBegin(){
+  displayPorts = 0;
+  for(int i = 0; i < RGB_PINS; i++){
+    displayMask[displayPortIdx(hwRgbPin(i))] |= digitalPinToBitMask(hwRgbPin(i));
+  }
+  for(int i = 0; i < GNDS; i++){
+    uint8_t p = displayPortIdx(hwGndPin(i));
+    displayMask[p] |= digitalPinToBitMask(hwGndPin(i));
+    displayGndMask[p] |= digitalPinToBitMask(hwGndPin(i));
+  }
+  // both frames and the last leds dark
+  memset(displayFrames, 0, sizeof(displayFrames));
+  memset(displayLast, 0, sizeof(displayLast));
+  displayPending = false;
+
+#ifdef ARDUINO
+  // Timer1 in CTC mode, clk/64, OCR1A is reloaded for every plane
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+    TCCR1A = 0;
+    TCCR1B = (1 << WGM12) | (1 << CS11) | (1 << CS10);
+    TCNT1 = 0;
+    OCR1A = DISPLAY_BCM_BASE_TICKS - 1;
+    TIMSK1 |= (1 << OCIE1A);
+  }
+#else
+  halTimer(displayTimer);
+#endif
+}
+
+// keeps the compiler from moving the frame stores across the displayPending
+// writes, volatile only orders volatile accesses
+static inline void displayBarrier(){
+  __asm__ __volatile__("" ::: "memory");
+}
+
+static bool displaySame(const LedColor color[ROW][COL]){
+  // field by field, the spare bits of a LedColor are never set up
+  for(int i = 0; i < ROW; i++){
+    for(int j = 0; j < COL; j++){
+      const LedColor &a = color[i][j], &b = displayLast[i][j];
+      if(a.r != b.r || a.g != b.g || a.b != b.b || a.on != b.on)
+        return false;
+    }
+  }
+  return true;
+}
+
+bool displayShow(const LedColor color[ROW][COL]){
+  if(displaySame(color))
+    return false;
+  memcpy(displayLast, color, sizeof(displayLast));
+
+  // the interrupt won't swap while this is clear, after that front is ours
+  // to read and back is ours to write
+  displayPending = false;
+  displayBarrier();
+  DisplayFrame &back = displayFrames[!displayFront];
+  memset(&back, 0, sizeof(back));
+  for(int i = 0; i < ROW; i++){
+    for(int j = 0; j < COL; j++){
+      if(!color[i][j].on)
+        continue;
+      for(int q = 0; q < RGB+1; q++){
+        uint8_t pin = hwBoardPin(i, j, q);
+        uint8_t p = displayPortIdx(pin);
+        uint8_t bit = digitalPinToBitMask(pin);
+        // q == 0 is the ground of column j, it stays on for every plane
+        uint8_t duty = 0xFF;
+        if(q > 0){
+          duty = pgm_read_byte(&GAMMA[ledLevel(color[i][j], q-1)]);
+        }
+        for(uint8_t b = 0; b < DISPLAY_BCM_BITS; b++){
+          if(duty & (1 << b))
+            back.bits[j][b][p] |= bit;
+        }
+      }
+    }
+  }
+  displayBarrier();
+  displayPending = true;
+  return true;
+}
+
+void displayClear(){
+  LedColor off[ROW][COL];
+  memset(off, 0, sizeof(off));
+  displayShow(off);
+}
+
+// move on to the next plane, returns how many ticks it should stay on
+static uint16_t displayAdvance(){
+  if(++displayPlane >= DISPLAY_BCM_BITS){
+    displayPlane = 0;
+    if(++displayColumn >= GNDS){
+      displayColumn = 0;
+      // a refresh starts, the only place a new frame may come in
+      if(displayPending){
+        displayFront = !displayFront;
+        displayPending = false;
+      }
+    }
+  }
+  return DISPLAY_BCM_BASE_TICKS << displayPlane;
+}
+
+// put the current plane on the ports
+static void displayOutput(){
+  const uint8_t *bits = displayFrames[displayFront].bits[displayColumn][displayPlane];
+  if(displayPlane == 0){
+    // grounds off first so the new colours never show on the old column
+    for(uint8_t p = 0; p < displayPorts; p++){
+      halPortWrite(displayPort[p], *displayPort[p] & ~displayGndMask[p]);
+    }
+  }
+  for(uint8_t p = 0; p < displayPorts; p++){
+    halPortWrite(displayPort[p], (*displayPort[p] & ~displayMask[p]) | bits[p]);
+  }
+}
+
+// one compare match -> the next plane's length goes in before anything
+// else, the shortest plane is only 3 ticks (192 cycles) and other
+// interrupts may have run first, a compare the count is already past would
+// only come after it wraps at 0xFFFF (262ms with one column lit), so that
+// plane is restarted instead and just comes late
+static void displayScan(){
+  uint32_t start = profCycles();
+  displayCompare(displayAdvance());
+  displayOutput();
+  if(displayMissed())
+    displayRestart();
+  profIsr(profCycles() - start);
+}
+
+#ifdef ARDUINO
+ISR(TIMER1_COMPA_vect){
+  displayScan();
+}
+#else
+static uint32_t displayTimer(){
+  displayClearedNs = 0;
+  displayScan();
+  // a lost compare waits for the count to wrap
+  uint32_t ticks = displayOcr + 1 + (displayLost ? 0x10000UL : 0);
+  return (displayClearedNs + ticks * DISPLAY_TICK_NS) / 1000;
+}
+#endif
@@ -0,0 +1,573 @@
+/*
+ * @author            Joshua Page
+ * @date_of_creation  Jan 26th, 2022
+ * @date_last_edit    ?? ??, 2021
+ * @version           v9
+ * @board             MEGA 2560
+ * @description       Start from scratch
+ * @global            WORKING AI!!
+*/
+
+/*
+  *@game convention overview
+  *           X == 1, O == 0, empty == -1
+  *           user can chose which color of X and O
+  *           led board works on an x,y coordinate system
+  *                 |-> e.g. the first led -> led0 == (0,0)
+  *
+*/
+
+#include "hal.h"
+#include "game.h"
+#include "budget.h"
+#include "display.h"
+#include "input.h"
+#include "profile.h"
+#include "protocol.h"
+#include "animation.h"
+#include "gamelog.h"
+
+// game constants
+const int NUM_COLORS = 18;
+
+// COLORS -> every channel is 0 (off) to LED_MAX (full), see display.h
+const uint8_t allColor[NUM_COLORS][RGB] PROGMEM = {
+                                        {15,0,0},   // red
+                                        {0,15,0},   // green
+                                        {0,0,15},   // blue
+                                        {0,15,15},  // light blue
+                                        {15,15,0},  // lime green
+                                        {15,0,15},  // pink
+                                        {15,15,15}, // white
+                                        {15,5,0},   // orange
+                                        {15,10,0},  // amber
+                                        {8,15,0},   // chartreuse
+                                        {0,15,6},   // spring green
+                                        {0,8,15},   // sky blue
+                                        {6,0,15},   // violet
+                                        {8,0,8},    // purple
+                                        {15,0,6},   // rose
+                                        {15,10,5},  // warm white
+                                        {6,6,6},    // dim white
+                                        {4,0,0}};   // dim red
+const int8_t PINK = 5;
+const int8_t GREEN = 1;
+const int8_t AMBER = 8;
+const int8_t SKY_BLUE = 11;
+
+// start screen indicator per AI mode, off for AI_SMART
+const int8_t aiModeColor[AI_MODES] = {PINK, PINK, SKY_BLUE, GREEN, AMBER};
+
+// event timing
+const uint16_t blinkSpeed = 250;
+const uint16_t pauseSpeed = 1350;
+const unsigned long aiSliceTime = 1000; // us of search per aiTask()
+const uint32_t attractDelay = 30000;   // ms of idle start screen before attract mode
+
+// start screen leds
+const int8_t setupXpos[PAIR] = {0,0};
+const int8_t setupOpos[PAIR] = {0,2};
+const int8_t setupRandomPos[PAIR] = {2,1};
+
+GameState game;
+static_assert(sizeof(GameState) <= BUDGET_GAME, "GameState is over its SRAM budget, see budget.h");
+
+void printBoard(int board[ROW][COL]){
+  // debug text goes out as a log frame, see protocol.h
+  char text[ROW*(COL+1) + 1];
+  char *c = text;
+  for(int i = 0; i < ROW; i++){
+    for(int j = 0; j < COL; j++){
+      *c++ = board[i][j] == 1 ? 'X' : board[i][j] == 0 ? 'O' : '.';
+    }
+    *c++ = '\n';
+  }
+  *c = 0;
+  protoLog(text);
+}
+void printBoard(const Board &board){
+  int cells[ROW][COL];
+  bbToArray(board, cells);
+  printBoard(cells);
+}
+void printPos(int _pos[2]){
+  char text[] = {(char)('0' + _pos[0]), ',', (char)('0' + _pos[1]), 0};
+  protoLog(text);
+}
+
+void checkButton(bool checkCancel){
+  if(checkCancel){
+    // debounced presses queued by the button interrupt, see input.cpp
+    game.buttons = inputPoll();
+    if(game.buttons){
+      profPress(inputLastPress());
+    }
+  }else{
+    game.buttons = 0;
+  }
+}
+
+void allOff(){
+  // turn every led off
+  displayClear();
+}
+
+void drawBoard(){
+  // the matrix is scanned by a timer interrupt (display.cpp), only hand it
+  // a new frame when something changed, displayShow() skips a repaint of
+  // the same colours
+  if(game.dirty){
+    uint32_t start = profCycles();
+    game.dirty = false;
+    bool shown = displayShow(game.color);
+    profDraw(profCycles() - start);
+    if(shown){
+      profShown();
+    }
+  }
+}
+
+LedColor paletteColor(int8_t color, bool OnOff){
+  // color -> index into allColor
+  LedColor led;
+  led.r = pgm_read_byte(&allColor[color][0]);
+  led.g = pgm_read_byte(&allColor[color][1]);
+  led.b = pgm_read_byte(&allColor[color][2]);
+  if(OnOff){
+    led.on = 1;
+  }else{
+    led.on = 0;
+  }
+  return led;
+}
+void colorLED(int8_t color, const int8_t *pos, bool OnOff){
+  game.color[pos[0]][pos[1]] = paletteColor(color, OnOff);
+  game.dirty = true;
+}
+void ledOff(const int8_t *pos){
+  game.color[pos[0]][pos[1]] = LedColor{};
+  game.dirty = true;
+}
+void placeTicOrToe(const int8_t *pos){
+  // the session knows whose turn it is
+  sessionPlay(game.session, bbCell(pos[0], pos[1]));
+  glogMove(bbCell(pos[0], pos[1]));
+}
+
+void playEffect(const AnimFrame *seq){
+  // the animation task plays it from the next tick, see animation.h
+  AnimContext ctx;
+  ctx.x = paletteColor(game.idxXcolor, true);
+  ctx.o = paletteColor(game.idxOcolor, true);
+  ctx.winner = game.session.winner == 10 ? ctx.x : ctx.o;
+  ctx.winLine = game.winLine;
+  ctx.xCells = game.session.board.x;
+  animPlay(seq, ctx);
+}
+
+void zeroBoards(){
+  // zero the game board and the board color
+  game.winLine = 0;
+  game.session.board.x = 0;
+  game.session.board.o = 0;
+  memset(game.color, 0, sizeof(game.color));
+  game.dirty = true;
+}
+
+// Game Function, the rules themselves are in session.cpp
+void getWinnerLine(const Board &board){
+  // assue input will have a winning line -> i.e. No cats game
+  game.winLine = bbWinLine(board);
+}
+void getFirstPos(const Board &board){
+  // return id cats game and first open place
+  for(int i = 0; i < ROW; i++){
+    for(int j = 0; j < COL; j++){
+      if(bbGet(board, i, j) == -1){
+        game.pos[0] = i; game.pos[1] = j;
+        return;
+      }
+    }
+  }
+}
+void move(const Board &board, int direction, bool XO){
+  int8_t test_pos[PAIR]; // test possition (x,y) -> to check is pos can be placed
+  test_pos[0] = game.pos[0]; test_pos[1] = game.pos[1];
+  do{
+    switch(direction){
+      case(0):
+        test_pos[0]--;
+        if(test_pos[0] < 0){
+          test_pos[0] = ROW-1; test_pos[1]++;
+          if(test_pos[1] > COL-1){
+            test_pos[1] = 0;
+          }
+        }
+        break;
+      case(1):
+        test_pos[1]++;
+        if(test_pos[1] > COL-1){
+          test_pos[0]++; test_pos[1] = 0;
+          if(test_pos[0] > ROW-1){
+            test_pos[0] = 0;
+          }
+        }
+        break;
+      case(2):
+        test_pos[0]++;
+        if(test_pos[0] > ROW-1){
+          test_pos[0] = 0; test_pos[1]++;
+          if(test_pos[1] > COL-1){
+            test_pos[1] = 0;
+          }
+        }
+        break;
+      case(3):
+        test_pos[1]--;
+        if(test_pos[1] < 0){
+          test_pos[0]++; test_pos[1] = COL-1;
+          if(test_pos[0] > ROW-1){
+            test_pos[0] = 0;
+          }
+        }
+        break;
+    }
+  }while(bbGet(board, test_pos[0], test_pos[1]) != -1);
+
+  ledOff(game.pos);
+  game.pos[0] = test_pos[0]; game.pos[1] = test_pos[1];
+  if(XO){
+    colorLED(game.idxXcolor, game.pos, true);
+  }else{
+    colorLED(game.idxOcolor, game.pos, true);
+  }
+
+}
+
+void aiTask(){
+  // one slice of the AI's move, gameScreen() places it once it is done
+  if(game.mode != 1 || !game.aiThinking){
+    return;
+  }
+  uint32_t start = profCycles();
+  int best;
+  bool done = sessionAiStep(game.session, aiSliceTime, best);
+  game.aiCycles += profCycles() - start;
+  if(!done){
+    return;
+  }
+  game.pos[0] = best / COL; game.pos[1] = best % COL;
+  if(game.session.aiMode != AI_RANDOM){
+    profSearch(game.aiCycles, sessionAiNodes(game.session));
+  }
+  game.aiThinking = false;
+}
+
+void startLeds(){
+  // X and O colours plus the AI mode indicator, nothing else
+  memset(game.color, 0, sizeof(game.color));
+  colorLED(game.idxOcolor, setupOpos, true);
+  colorLED(game.idxXcolor, setupXpos, true);
+  colorLED(aiModeColor[game.session.aiMode], setupRandomPos, game.session.aiMode != AI_SMART);
+}
+
+void gameSetup(){
+
+  animBegin(allColor, NUM_COLORS);
+  animStop();
+  allOff();
+  zeroBoards();
+
+  game.pos[0] = 0; game.pos[1] = 0;
+
+  game.idxXcolor = 0; game.idxOcolor = 2;
+  game.session.aiMode = AI_SMART;
+  startLeds();
+
+  game.currentTime = millis();
+  game.blinkDue = game.currentTime;
+  game.pauseDue = game.currentTime;
+  game.idleDue = game.currentTime + attractDelay;
+
+  game.instSwitch = false;
+  game.isOnOff = false;
+  game.aiThinking = false;
+  game.instPartyTime = false;
+  game.instPauseTime = false;
+
+  // START GAME
+  game.mode = 0;
+
+}
+int startScreen(){
+
+  if(game.buttons){
+    game.idleDue = game.currentTime + attractDelay;
+    if(animPlaying()){
+      // any button wakes the start screen back up
+      animStop();
+      startLeds();
+      game.instSwitch = true;
+      return 0;
+    }
+  }else if(!animPlaying() && schedDue(game.currentTime, game.idleDue)){
+    protoLog("attract mode");
+    playEffect(ANIM_ATTRACT);
+  }
+  if(animPlaying()){
+    return 0;
+  }
+
+  if(buttonEvent(1) && buttonEvent(3)){
+    game.instSwitch = true;
+    game.session.twoPlayer = true;
+    protoLog("Two Player Game");
+  }else if((game.pos[1] == 2 || game.session.twoPlayer) && buttonEvent(3)){
+    // left
+    game.pos[1] = 0;
+    game.instSwitch = true;
+    game.isOnOff = false;
+    game.session.twoPlayer = false;
+  }else if((game.pos[1] == 0 || game.session.twoPlayer) && buttonEvent(1)){
+    // right
+    game.pos[1] = 2;
+    game.instSwitch = true;
+    game.isOnOff = false;
+    game.session.twoPlayer = false;
+  }else if(buttonEvent(0) && buttonEvent(2)){
+    // smart -> random -> mcts -> easy -> medium, the indicator led shows which
+    game.session.aiMode = (game.session.aiMode + 1) % AI_MODES;
+    colorLED(aiModeColor[game.session.aiMode], setupRandomPos, game.session.aiMode != AI_SMART);
+  }else if(buttonEvent(2)){
+    // down
+    game.instSwitch = true;
+    game.isOnOff = true;
+    if(game.pos[1]==0){
+      do{
+        game.idxXcolor--;
+        if(game.idxXcolor == -1){
+          game.idxXcolor = NUM_COLORS-1;
+        }
+      }while(game.idxXcolor == game.idxOcolor);
+    }else{
+      do{
+        game.idxOcolor--;
+        if(game.idxOcolor == -1){
+          game.idxOcolor = NUM_COLORS-1;
+        }
+      }while(game.idxXcolor == game.idxOcolor);
+    }
+  }else if(buttonEvent(0)){
+    //up
+    game.instSwitch = true;
+    game.isOnOff = true;
+    if(game.pos[1]==0){
+      do{
+        game.idxXcolor++;
+        if(game.idxXcolor == NUM_COLORS){
+          game.idxXcolor = 0;
+        }
+      }while(game.idxXcolor == game.idxOcolor);
+    }else{
+      do{
+        game.idxOcolor++;
+        if(game.idxOcolor == NUM_COLORS){
+          game.idxOcolor = 0;
+        }
+      }while(game.idxXcolor == game.idxOcolor);
+    }
+  }else if(buttonEvent(4)){
+
+
+    // picking O (pos[1] == 2) leaves X and the first move to the AI
+    bool aiX = !(game.pos[1] == 0 || game.session.twoPlayer);
+    sessionBegin(game.session, game.session.aiMode, game.session.twoPlayer, aiX);
+
+    game.instSwitch = true;
+    game.firstAiMove = true;
+    game.new_game = true;
+    game.new_turn = true;
+    game.pos[0] = 0; game.pos[1] = 0;
+
+    // defaults are X red, O blue, see gameSetup()
+    glogStart(game.session.aiMode, game.session.twoPlayer, aiX, game.idxXcolor != 0 || game.idxOcolor != 2);
+
+    allOff();
+    zeroBoards();
+
+    return 1;
+  }
+
+  // blink indexed led
+  if(schedDue(game.currentTime, game.blinkDue) || game.instSwitch){
+    game.blinkDue = game.currentTime + blinkSpeed;
+
+    if(game.instSwitch){
+      game.instSwitch = false;
+      if(!game.session.twoPlayer){
+        if(game.pos[1] == 0){
+          colorLED(game.idxOcolor, setupOpos, true);
+        }else{
+          colorLED(game.idxXcolor, setupXpos, true);
+        }
+      }
+    }
+
+    if(game.session.twoPlayer){
+      colorLED(game.idxXcolor, setupXpos, game.isOnOff);
+      colorLED(game.idxOcolor, setupOpos, game.isOnOff);
+    }else{
+      if(game.pos[1] == 0){
+        colorLED(game.idxXcolor, setupXpos, game.isOnOff);
+      }else{
+        colorLED(game.idxOcolor, setupOpos, game.isOnOff);
+      }
+    }
+
+    if(game.isOnOff){
+      game.isOnOff = false;
+    }else{
+      game.isOnOff = true;
+    }
+  }
+
+  return 0;
+}
+int gameScreen(){
+
+  if(game.new_turn){
+    game.new_turn = false;
+    //printBoard(game.session.board);
+    if(game.session.over){
+      glogFinish();
+      if(game.session.winner != 0){
+        getWinnerLine(game.session.board);
+      }
+      game.instSwitch = true;
+      return 3;
+    }
+    // game.instPauseTime = true;
+    // game.pauseDue = game.currentTime + pauseSpeed;
+
+    game.XO_turn = userTurn(game.session.board);
+
+    if(sessionAiToMove(game.session)){
+      // aiTask() works the move out, random ones included
+      game.aiThinking = true;
+      game.aiCycles = 0;
+    }else{
+      getFirstPos(game.session.board);
+    }
+
+  }
+
+  if(sessionAiToMove(game.session)){
+    if(game.aiThinking){
+      // aiTask() is still slicing the search
+      return 1;
+    }
+    if(game.XO_turn){
+      colorLED(game.idxXcolor, game.pos, true);
+    }else{
+      colorLED(game.idxOcolor, game.pos, true);
+    }
+
+    placeTicOrToe(game.pos);
+    game.new_turn = true;
+    game.instSwitch = true;
+
+  }else{
+    // up(0), right(1), down(2), left(3), select(4)
+    if(buttonEvent(3) && buttonEvent(1)){
+      // secret party screen ->   EASTER EGG
+      protoLog("party mode");
+      game.instSwitch = true;
+      return 4;
+    }else if(buttonEvent(2)){
+      move(game.session.board, 2, game.XO_turn);
+      game.instSwitch = true;
+    }else if(buttonEvent(0)){
+      move(game.session.board, 0, game.XO_turn);
+      game.instSwitch = true;
+    }else if(buttonEvent(1)){
+      move(game.session.board, 1, game.XO_turn);
+      game.instSwitch = true;
+    }else if(buttonEvent(3)){
+      move(game.session.board, 3, game.XO_turn);
+      game.instSwitch = true;
+    }else if(buttonEvent(4)){
+      if(game.XO_turn){
+        colorLED(game.idxXcolor, game.pos, true);
+      }else{
+        colorLED(game.idxOcolor, game.pos, true);
+      }
+      // the session hands the turn to the AI unless it is a 2 player game
+      placeTicOrToe(game.pos);
+      game.new_turn = true;
+      game.instSwitch = true;
+
+    }
+  }
+
+  if(schedDue(game.currentTime, game.blinkDue) || game.instSwitch){
+    game.blinkDue = game.currentTime + blinkSpeed;
+    if(game.instSwitch){
+      game.instSwitch = false;
+      game.isOnOff = true;
+    }
+
+    if(game.XO_turn){
+      colorLED(game.idxXcolor, game.pos, game.isOnOff);
+    }else{
+      colorLED(game.idxOcolor, game.pos, game.isOnOff);
+    }
+
+    if(game.isOnOff){
+      game.isOnOff = false;
+    }else{
+      game.isOnOff = true;
+    }
+
+  }
+
+  return 1; // gameScreen
+
+}
+int endScreen(){
+
+  if(game.instSwitch){
+    game.instSwitch = false;
+    // cats game -> the whole board, a win -> just the line
+    if(game.session.winner == 0){
+      playEffect(ANIM_CATS_GAME);
+    }else{
+      playEffect(ANIM_WIN);
+    }
+  }
+
+  if(buttonEvent(4)){
+    gameSetup();
+    return 0;
+  }
+  return 3;
+}
+int partyScreen(){
+
+  if(game.instSwitch){
+    game.instSwitch = false;
+    playEffect(ANIM_PARTY);
+  }
+
+  if(buttonEvent(4)){
+    gameSetup();
+    return 0;
+  }
+  return 4;
+}
+void pauseScreen(){
+  // this function is not a game screen but rather a fuction the pauses the
+  // game without disrupting the screen animation
+  if(schedDue(game.currentTime, game.pauseDue)){
+    game.instPauseTime = false;
+  }
+}
@@ -0,0 +1,244 @@
+#include "hal.h"
+#include "gamelog.h"
+#include "budget.h"
+#include "protocol.h"
+
+#include <stddef.h>
+
+const uint8_t GLOG_CODE_BITS = 19;
+const uint8_t GLOG_COUNT_SHIFT = 19;
+const uint8_t GLOG_META_SHIFT = 23;   // mode, two player, AI is X, colours
+const uint8_t GLOG_LAP_SHIFT = 29;
+const uint32_t GLOG_RESERVED = 0xC0000000;
+const uint8_t GLOG_META_TWO_PLAYER = 1 << 3;
+const uint8_t GLOG_META_AI_X = 1 << 4;
+const uint8_t GLOG_META_COLORS = 1 << 5;
+const uint8_t GLOG_ACTIVE = 0x80;     // in flags, a game is being recorded
+const uint8_t GLOG_TOTALS_SIZE = sizeof(GlogTotals);
+
+struct GlogState {
+  GlogTotals totals;    // lifetime, the checkpoint is streamed out of here
+  uint32_t record;      // being written at head - 1
+  uint32_t code;        // move order of the game in progress
+  uint16_t head;        // next record
+  uint16_t free;        // empty cells of the game in progress
+  uint8_t count;        // its moves
+  uint8_t flags;        // its meta bits | GLOG_ACTIVE
+  uint8_t recordNext;   // record bytes written, GLOG_RECORD == done
+  uint8_t totalsNext;   // checkpoint bytes written, GLOG_TOTALS_SIZE == done
+};
+
+GlogState glog;
+static_assert(sizeof(GlogState) <= BUDGET_GLOG, "game log is over its SRAM budget, see budget.h");
+static_assert(GLOG_RECORDS <= 1 << 15, "head is a uint16_t");
+
+static uint8_t *glogAddress(uint16_t offset){
+  return (uint8_t *)(uintptr_t)offset;
+}
+
+static uint16_t glogCrc(const GlogTotals &t){
+  uint16_t crc = 0xFFFF;
+  const uint8_t *b = (const uint8_t *)&t;
+  for(uint8_t i = 0; i < offsetof(GlogTotals, crc); i++)
+    crc = protoCrc(crc, b[i]);
+  return crc;
+}
+
+static uint32_t glogRead(uint16_t index){
+  uint16_t offset = GLOG_RING_START + index * GLOG_RECORD;
+  uint32_t record = 0;
+  for(uint8_t i = 0; i < GLOG_RECORD; i++)
+    record |= (uint32_t)eeprom_read_byte(glogAddress(offset + i)) << (8*i);
+  return record;
+}
+
+static bool glogValid(uint32_t record){
+  GlogGame g;
+  return glogDecode(record, g) && glogResult(g) != -1;
+}
+
+// add a record's game to the totals
+static void glogCount(uint32_t record){
+  GlogGame g;
+  if(!glogDecode(record, g))
+    return;
+  int8_t result = glogResult(g);
+  if(result != -1)
+    glog.totals.games[g.twoPlayer ? GLOG_TWO_PLAYER : g.mode][result]++;
+}
+
+static void glogFlush(){
+  while(glogBusy())
+    glogPoll();
+}
+
+void glogBegin(){
+  // newest good checkpoint
+  bool found = false;
+  for(uint8_t slot = 0; slot < 2; slot++){
+    GlogTotals t;
+    uint8_t *b = (uint8_t *)&t;
+    for(uint8_t i = 0; i < GLOG_TOTALS_SIZE; i++)
+      b[i] = eeprom_read_byte(glogAddress(slot * GLOG_CHECKPOINT_SLOT + i));
+    if(t.crc != glogCrc(t) || (t.laps & 1) != slot)
+      continue;
+    if(!found || t.laps > glog.totals.laps)
+      glog.totals = t;
+    found = true;
+  }
+
+  if(!found){
+    // new chip or some other sketch's data -> erase the records (only the
+    // byte with the reserved bits) and start at lap 0
+    for(uint16_t i = 0; i < GLOG_RECORDS; i++)
+      eeprom_update_byte(glogAddress(GLOG_RING_START + i * GLOG_RECORD + GLOG_RECORD - 1), 0xFF);
+    memset(&glog.totals, 0, sizeof(glog.totals));
+    glog.totals.crc = glogCrc(glog.totals);
+    glog.totalsNext = 0;
+    glog.recordNext = GLOG_RECORD;
+    glogFlush();
+  }
+
+  // this lap's records are the ones from the start with its lap bit
+  glog.head = 0;
+  uint32_t lap = glog.totals.laps & 1;
+  while(glog.head < GLOG_RECORDS){
+    uint32_t record = glogRead(glog.head);
+    if(!glogValid(record) || ((record >> GLOG_LAP_SHIFT) & 1) != lap)
+      break;
+    glogCount(record);
+    glog.head++;
+  }
+  glog.totalsNext = GLOG_TOTALS_SIZE;
+  glog.recordNext = GLOG_RECORD;
+  glog.flags = 0;
+}
+
+void glogStart(uint8_t mode, bool twoPlayer, bool aiX, bool customColors){
+  glog.code = 0;
+  glog.free = BB_FULL;
+  glog.count = 0;
+  glog.flags = GLOG_ACTIVE | (mode & 7);
+  if(twoPlayer)
+    glog.flags |= GLOG_META_TWO_PLAYER;
+  if(aiX)
+    glog.flags |= GLOG_META_AI_X;
+  if(customColors)
+    glog.flags |= GLOG_META_COLORS;
+}
+
+void glogMove(uint8_t cell){
+  uint16_t bit = bbBit(cell);
+  if(!(glog.flags & GLOG_ACTIVE) || !(glog.free & bit))
+    return;
+  // digit == which of the empty cells, counted from cell 0
+  glog.code = glog.code * (BB_CELLS - glog.count) + bbCount(glog.free & (bit - 1));
+  glog.free &= ~bit;
+  glog.count++;
+}
+
+void glogFinish(){
+  if(!(glog.flags & GLOG_ACTIVE))
+    return;
+  glog.flags &= ~GLOG_ACTIVE;
+  uint32_t record = glog.code | (uint32_t)glog.count << GLOG_COUNT_SHIFT
+                  | (uint32_t)(glog.flags & 0x3F) << GLOG_META_SHIFT;
+  if(!glogValid(record))
+    return;
+
+  // one game at a time, they are seconds apart so this hardly ever waits
+  glogFlush();
+  if(glog.head == GLOG_RECORDS){
+    // ring full -> checkpoint the totals, then the new lap overwrites it
+    glog.totals.laps++;
+    glog.totals.crc = glogCrc(glog.totals);
+    glog.totalsNext = 0;
+    glog.head = 0;
+  }
+  glog.record = record | (glog.totals.laps & 1) << GLOG_LAP_SHIFT;
+  glog.recordNext = 0;
+  glog.head++;
+}
+
+void glogPoll(){
+  if(!eeprom_is_ready())
+    return;
+  if(glog.totalsNext < GLOG_TOTALS_SIZE){
+    uint16_t offset = (glog.totals.laps & 1) * GLOG_CHECKPOINT_SLOT + glog.totalsNext;
+    eeprom_update_byte(glogAddress(offset), ((const uint8_t *)&glog.totals)[glog.totalsNext]);
+    glog.totalsNext++;
+  }else if(glog.recordNext < GLOG_RECORD){
+    // the checkpoint is out, only now may the totals count this game
+    if(glog.recordNext == 0)
+      glogCount(glog.record);
+    // the byte with the lap bit goes last, until then the old record stands
+    uint16_t offset = GLOG_RING_START + (glog.head - 1) * GLOG_RECORD + glog.recordNext;
+    eeprom_update_byte(glogAddress(offset), (uint8_t)(glog.record >> (8*glog.recordNext)));
+    glog.recordNext++;
+  }
+}
+
+bool glogBusy(){
+  return glog.totalsNext < GLOG_TOTALS_SIZE || glog.recordNext < GLOG_RECORD;
+}
+
+const GlogTotals &glogTotals(){
+  return glog.totals;
+}
+
+uint16_t glogStored(){
+  return glog.totals.laps ? GLOG_RECORDS : glog.head;
+}
+
+uint32_t glogRecord(uint16_t back){
+  uint16_t stored = glogStored();
+  if(back >= stored)
+    return UINT32_MAX;
+  if(back == 0 && glog.recordNext < GLOG_RECORD)
+    return glog.record;
+  return glogRead((glog.head + GLOG_RECORDS - 1 - back) % GLOG_RECORDS);
+}
+
+bool glogDecode(uint32_t record, GlogGame &game){
+  if(record & GLOG_RESERVED)
+    return false;
+  game.count = (record >> GLOG_COUNT_SHIFT) & 0xF;
+  uint8_t meta = record >> GLOG_META_SHIFT;
+  game.mode = meta & 7;
+  game.twoPlayer = meta & GLOG_META_TWO_PLAYER;
+  game.aiX = meta & GLOG_META_AI_X;
+  game.customColors = meta & GLOG_META_COLORS;
+  if(game.count > BB_CELLS || game.mode >= AI_MODES)
+    return false;
+  // digits come off the low end last move first
+  uint32_t code = record & ((1UL << GLOG_CODE_BITS) - 1);
+  uint8_t digits[BB_CELLS];
+  for(int8_t i = game.count - 1; i >= 0; i--){
+    digits[i] = code % (BB_CELLS - i);
+    code /= BB_CELLS - i;
+  }
+  if(code)
+    return false;
+  uint16_t free = BB_FULL;
+  for(uint8_t i = 0; i < game.count; i++){
+    uint16_t mask = free;
+    for(uint8_t d = digits[i]; d; d--)
+      mask &= mask - 1;
+    game.moves[i] = __builtin_ctz(mask);
+    free &= ~bbBit(game.moves[i]);
+  }
+  return true;
+}
+
+int8_t glogResult(const GlogGame &game){
+  // X always moves first
+  Board b = {0, 0};
+  for(uint8_t i = 0; i < game.count; i++)
+    bbPlace(b, game.moves[i], !(i & 1));
+  int8_t winner = bbWinner(b);
+  if(winner == -1)
+    return bbEmpty(b) ? -1 : GLOG_DRAW;
+  // the human's side, X in a two player game
+  bool humanX = game.twoPlayer || !game.aiX;
+  return winner == (int8_t)humanX ? GLOG_WIN : GLOG_LOSS;
+}
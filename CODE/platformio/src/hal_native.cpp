@@ -0,0 +1,290 @@
+// host stand-ins for the Arduino core, see hal.h
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <chrono>
+#include <deque>
+#include <thread>
+#include <vector>
+#include "hal.h"
+
+HalSerial Serial;
+
+// MEGA 2560 pin -> port (PA == 1 ... PL == 12) and bit, same as the core's tables
+enum { PA = 1, PB, PC, PD, PE, PF, PG, PH, PJ = 10, PK, PL };
+static const uint8_t PIN_PORT[HAL_PINS] = {
+  PE, PE, PE, PE, PG, PE, PH, PH, PH, PH,   // 0 - 9
+  PB, PB, PB, PB, PJ, PJ, PH, PH, PD, PD,   // 10 - 19
+  PD, PD, PA, PA, PA, PA, PA, PA, PA, PA,   // 20 - 29
+  PC, PC, PC, PC, PC, PC, PC, PC, PD, PG,   // 30 - 39
+  PG, PG, PL, PL, PL, PL, PL, PL, PL, PL,   // 40 - 49
+  PB, PB, PB, PB, PF, PF, PF, PF, PF, PF,   // 50 - 59
+  PF, PF, PK, PK, PK, PK, PK, PK, PK, PK    // 60 - 69
+};
+static const uint8_t PIN_BIT[HAL_PINS] = {
+  0, 1, 4, 5, 5, 3, 3, 4, 5, 6,
+  4, 5, 6, 7, 1, 0, 1, 0, 3, 2,
+  1, 0, 0, 1, 2, 3, 4, 5, 6, 7,
+  7, 6, 5, 4, 3, 2, 1, 0, 7, 2,
+  1, 0, 7, 6, 5, 4, 3, 2, 1, 0,
+  3, 2, 1, 0, 0, 1, 2, 3, 4, 5,
+  6, 7, 0, 1, 2, 3, 4, 5, 6, 7
+};
+
+// one register per port, outputs and driven inputs share it
+static volatile uint8_t halPort[HAL_PORTS];
+
+uint8_t digitalPinToPort(uint8_t pin){
+  return pin < HAL_PINS ? PIN_PORT[pin] : 0;
+}
+uint8_t digitalPinToBitMask(uint8_t pin){
+  return pin < HAL_PINS ? (uint8_t)(1 << PIN_BIT[pin]) : 0;
+}
+volatile uint8_t *portOutputRegister(uint8_t port){
+  return &halPort[port < HAL_PORTS ? port : 0];
+}
+volatile uint8_t *portInputRegister(uint8_t port){
+  return portOutputRegister(port);
+}
+
+static HalPortTrace portTrace;
+
+void halTracePorts(HalPortTrace trace){
+  portTrace = trace;
+}
+void halPortWrite(volatile uint8_t *reg, uint8_t value){
+  *reg = value;
+  if(portTrace)
+    portTrace(reg, value);
+}
+
+void pinMode(uint8_t pin, uint8_t mode){
+  if(mode == INPUT_PULLUP)
+    digitalWrite(pin, HIGH);
+}
+void digitalWrite(uint8_t pin, uint8_t val){
+  volatile uint8_t *reg = portOutputRegister(digitalPinToPort(pin));
+  if(val)
+    *reg |= digitalPinToBitMask(pin);
+  else
+    *reg &= ~digitalPinToBitMask(pin);
+}
+int digitalRead(uint8_t pin){
+  return (*portInputRegister(digitalPinToPort(pin)) & digitalPinToBitMask(pin)) ? HIGH : LOW;
+}
+void halSetInput(uint8_t pin, uint8_t level){
+  digitalWrite(pin, level);
+}
+int analogRead(uint8_t){
+  // floating pin noise, good enough for randomSeed()
+  return (int)(std::chrono::steady_clock::now().time_since_epoch().count() & 1023);
+}
+
+// clock ---------------------------------------------------------------------
+static bool simClock;
+static bool simRunning;
+static unsigned long simNow;
+static unsigned long simMark;   // wall clock at the last halAdvance()
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+
+static unsigned long wallMicros(){
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+           std::chrono::steady_clock::now() - bootTime).count();
+}
+unsigned long micros(){
+  if(simClock)
+    return simNow + (simRunning ? wallMicros() - simMark : 0);
+  return wallMicros();
+}
+unsigned long millis(){
+  return micros() / 1000;
+}
+void delay(unsigned long ms){
+  delayMicroseconds(ms * 1000);
+}
+void delayMicroseconds(unsigned int us){
+  if(simClock){
+    halAdvance(us);
+  }else{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+    halRunTimers();
+  }
+}
+void halUseSimClock(bool sim, bool running){
+  simNow = micros();
+  simMark = wallMicros();
+  simClock = sim;
+  simRunning = running;
+}
+
+// timers --------------------------------------------------------------------
+struct HalTimer {
+  HalTimerIsr isr;
+  unsigned long due;
+};
+static std::vector<HalTimer> halTimers;
+static HalIsrClock isrClock;
+
+void halTimer(HalTimerIsr isr){
+  halTimers.push_back({isr, micros()});
+}
+void halTraceIsr(HalIsrClock clock){
+  isrClock = clock;
+}
+uint32_t halIsrNs(){
+  return isrClock ? isrClock(false) : 0;
+}
+static void halFire(HalTimer &t){
+  if(isrClock)
+    isrClock(true);
+  t.due += t.isr();
+}
+// the earliest timer due at or before now, -1 if none
+static int halNextTimer(unsigned long now){
+  int next = -1;
+  for(size_t i = 0; i < halTimers.size(); i++){
+    if((long)(now - halTimers[i].due) >= 0 &&
+       (next == -1 || (long)(halTimers[i].due - halTimers[next].due) < 0))
+      next = (int)i;
+  }
+  return next;
+}
+void halRunTimers(){
+  unsigned long now = micros();
+  for(HalTimer &t : halTimers){
+    // a real interrupt would not queue up, skip what the host was too slow for
+    if((long)(now - t.due) > 100000)
+      t.due = now;
+  }
+  for(int i = halNextTimer(now); i != -1; i = halNextTimer(now)){
+    halFire(halTimers[i]);
+  }
+}
+void halAdvance(uint32_t us){
+  // take in the time code ran since the last call, timers see a still clock
+  bool running = simRunning;
+  simNow = micros();
+  simRunning = false;
+  unsigned long end = simNow + us;
+  for(int i = halNextTimer(end); i != -1; i = halNextTimer(end)){
+    // a timer that fell behind while code ran fires now, time never goes back
+    if((long)(halTimers[i].due - simNow) > 0)
+      simNow = halTimers[i].due;
+    halFire(halTimers[i]);
+  }
+  simNow = end;
+  simMark = wallMicros();
+  simRunning = running;
+}
+
+// random --------------------------------------------------------------------
+static uint32_t randomState = 1;
+
+long random(long howbig){
+  if(howbig == 0)
+    return 0;
+  // xorshift32, only needs to look random
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return (long)(randomState % (uint32_t)howbig);
+}
+long random(long howsmall, long howbig){
+  if(howsmall >= howbig)
+    return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+void randomSeed(unsigned long seed){
+  if(seed != 0)
+    randomState = (uint32_t)seed;
+}
+
+// eeprom --------------------------------------------------------------------
+static uint8_t eeprom[E2END + 1];
+static bool eepromErased;
+static unsigned long eepromWrites;
+
+uint8_t *halEeprom(){
+  if(!eepromErased){
+    memset(eeprom, 0xFF, sizeof(eeprom));
+    eepromErased = true;
+  }
+  return eeprom;
+}
+unsigned long halEepromWrites(){
+  return eepromWrites;
+}
+uint8_t eeprom_read_byte(const uint8_t *addr){
+  return halEeprom()[(uintptr_t)addr & E2END];
+}
+void eeprom_update_byte(uint8_t *addr, uint8_t value){
+  // like the real one, an unchanged byte is not written and does not wear
+  uint8_t &cell = halEeprom()[(uintptr_t)addr & E2END];
+  if(cell != value){
+    cell = value;
+    eepromWrites++;
+  }
+}
+
+// serial --------------------------------------------------------------------
+static std::deque<uint8_t> serialRx;
+static bool serialQuiet;
+
+void halSerialQuiet(bool quiet){
+  serialQuiet = quiet;
+}
+
+void halSerialFeed(const uint8_t *buf, size_t len){
+  serialRx.insert(serialRx.end(), buf, buf + len);
+}
+void HalSerial::begin(unsigned long){
+  setvbuf(stdout, NULL, _IOLBF, 0);
+}
+int HalSerial::available(){
+  return (int)serialRx.size();
+}
+int HalSerial::read(){
+  if(serialRx.empty())
+    return -1;
+  uint8_t b = serialRx.front();
+  serialRx.pop_front();
+  return b;
+}
+int HalSerial::availableForWrite(){
+  return 64;
+}
+size_t HalSerial::write(uint8_t b){
+  return write(&b, 1);
+}
+size_t HalSerial::write(const uint8_t *buf, size_t len){
+  if(serialQuiet)
+    return len;
+  return fwrite(buf, 1, len, stdout);
+}
+size_t HalSerial::print(const char *s){
+  return write((const uint8_t *)s, strlen(s));
+}
+size_t HalSerial::print(char c){
+  return write((uint8_t)c);
+}
+size_t HalSerial::print(int n){
+  return print((long)n);
+}
+size_t HalSerial::print(unsigned int n){
+  return print((unsigned long)n);
+}
+size_t HalSerial::print(long n){
+  char text[24];
+  snprintf(text, sizeof(text), "%ld", n);
+  return print(text);
+}
+size_t HalSerial::print(unsigned long n){
+  char text[24];
+  snprintf(text, sizeof(text), "%lu", n);
+  return print(text);
+}
+size_t HalSerial::println(){
+  return print("\n");
+}
+
+#endif
@@ -0,0 +1,132 @@
+#include "input.h"
+#include "budget.h"
+#ifdef ARDUINO
+#include <util/atomic.h>
+#endif
+
+// the buttons that take part in a two button combo
+const uint8_t CHORD_BUTTONS = (1 << BTN_UP) | (1 << BTN_RIGHT) | (1 << BTN_DOWN) | (1 << BTN_LEFT);
+
+static_assert((INPUT_QUEUE & (INPUT_QUEUE - 1)) == 0, "INPUT_QUEUE must be a power of two");
+
+volatile uint8_t *buttonPin[NUM_BUTTONS];
+uint8_t buttonMask[NUM_BUTTONS];
+
+// interrupt side
+uint8_t buttonStable[NUM_BUTTONS]; // 1 == pressed
+uint8_t buttonCount[NUM_BUTTONS];  // samples that disagree with buttonStable
+ButtonEvent inputQueue[INPUT_QUEUE];
+volatile uint8_t inputHead;        // written by the interrupt only
+volatile uint8_t inputTail;        // written by inputPoll() only
+volatile uint8_t inputLost;
+
+// loop side
+uint8_t chordMask;   // presses held back waiting for a partner
+uint16_t chordTime;
+uint16_t lastPress;
+static_assert(sizeof(inputQueue) + sizeof(buttonMask) + sizeof(buttonStable) + sizeof(buttonCount) <= BUDGET_INPUT,
+              "input is over its SRAM budget, see budget.h");
+
+#ifndef ARDUINO
+static uint32_t inputTimer();
+#endif
+
+void inputBegin(){
+  for(uint8_t i = 0; i < NUM_BUTTONS; i++){
+    buttonPin[i] = portInputRegister(digitalPinToPort(hwButtonPin(i)));
+    buttonMask[i] = digitalPinToBitMask(hwButtonPin(i));
+    buttonStable[i] = 0;
+    buttonCount[i] = 0;
+  }
+  inputHead = 0;
+  inputTail = 0;
+  chordMask = 0;
+
+#ifdef ARDUINO
+  // piggy back on Timer0, compare A fires once per millis() tick
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+    OCR0A = 0x80;
+    TIMSK0 |= (1 << OCIE0A);
+  }
+#else
+  halTimer(inputTimer);
+#endif
+}
+
+static void inputPush(uint8_t button, uint8_t pressed){
+  uint8_t next = (inputHead + 1) & (INPUT_QUEUE - 1);
+  if(next == inputTail){
+    inputLost++;
+    return;
+  }
+  ButtonEvent &e = inputQueue[inputHead];
+  e.time = millis();
+  e.button = button;
+  e.pressed = pressed;
+  inputHead = next;
+}
+
+static void inputSample(){
+  for(uint8_t i = 0; i < NUM_BUTTONS; i++){
+    // pull ups -> a pressed button reads LOW
+    uint8_t down = !(*buttonPin[i] & buttonMask[i]);
+    if(down == buttonStable[i]){
+      buttonCount[i] = 0;
+    }else if(++buttonCount[i] >= DEBOUNCE_SAMPLES){
+      buttonCount[i] = 0;
+      buttonStable[i] = down;
+      inputPush(i, down);
+    }
+  }
+}
+
+#ifdef ARDUINO
+ISR(TIMER0_COMPA_vect){
+  inputSample();
+}
+#else
+static uint32_t inputTimer(){
+  inputSample();
+  return 1024; // same rate as Timer0 on a 16MHz MEGA
+}
+#endif
+
+uint8_t inputPoll(){
+  uint8_t taken = 0; // buttons that already have a press this frame
+
+  while(inputTail != inputHead){
+    const ButtonEvent &e = inputQueue[inputTail];
+    uint8_t bit = 1 << e.button;
+    if(e.pressed){
+      // a second press of the same button waits for the next frame
+      if((taken | chordMask) & bit)
+        break;
+      lastPress = e.time;
+      if(!(CHORD_BUTTONS & bit)){
+        taken |= bit;
+      }else if(chordMask && (uint16_t)(e.time - chordTime) <= CHORD_MS){
+        taken |= chordMask | bit;
+        chordMask = 0;
+      }else{
+        taken |= chordMask;
+        chordMask = bit;
+        chordTime = e.time;
+      }
+    }
+    inputTail = (inputTail + 1) & (INPUT_QUEUE - 1);
+  }
+
+  // nobody joined the held press in time
+  if(chordMask && (uint16_t)((uint16_t)millis() - chordTime) > CHORD_MS){
+    taken |= chordMask;
+    chordMask = 0;
+  }
+  return taken;
+}
+
+uint16_t inputLastPress(){
+  return lastPress;
+}
+uint8_t inputDropped(){
+  return inputLost;
+}
@@ -0,0 +1,271 @@
+#include "hal.h"
+#include "mcts.h"
+#include "budget.h"
+#include "rng.h"
+
+#include <math.h>
+
+// exploration weight of UCT, sqrt(2)
+const float MCTS_EXPLORE = 1.41f;
+// visits are 16 bit and a node's score can be twice its visits, stop a
+// search before a winning child's score could wrap
+const uint16_t MCTS_MAX_VISITS = 32767;
+const uint8_t MCTS_PATH = BB_CELLS + 1;
+
+HAL_THREAD_LOCAL MctsNode mctsArena[MCTS_NODES];
+HAL_THREAD_LOCAL uint16_t mctsUsed;
+HAL_THREAD_LOCAL uint16_t mctsReused;
+HAL_THREAD_LOCAL Board mctsRootBoard;
+HAL_THREAD_LOCAL Rng mctsRng;
+HAL_THREAD_LOCAL uint16_t mctsTarget;   // root visits to stop at
+HAL_THREAD_LOCAL uint16_t mctsCount;    // playouts of this search
+HAL_THREAD_LOCAL bool mctsBusy;
+static_assert(sizeof(mctsArena) <= MCTS_SRAM_BUDGET, "MCTS arena over budget");
+static_assert(sizeof(mctsUsed) + sizeof(mctsReused) + sizeof(mctsRootBoard) + sizeof(mctsRng)
+              + sizeof(mctsTarget) + sizeof(mctsCount) + sizeof(mctsBusy) <= BUDGET_MCTS,
+              "MCTS is over its SRAM budget, see budget.h");
+
+static uint16_t mctsAlloc(uint8_t move, const Board &board){
+  if(mctsUsed == MCTS_NODES)
+    return 0;
+  MctsNode &n = mctsArena[mctsUsed];
+  n.visits = 0;
+  n.score = 0;
+  n.child = 0;
+  n.sibling = 0;
+  n.move = move;
+  n.untried = bbWinner(board) == -1 ? bbEmpty(board) : 0;
+  return mctsUsed++;
+}
+
+static void mctsReset(const Board &board){
+  mctsUsed = 0;
+  mctsRootBoard = board;
+  mctsAlloc(0, board);
+}
+
+// cell of the pick-th empty cell
+static uint8_t mctsNth(uint16_t mask, uint8_t pick){
+  while(pick--){
+    mask &= mask - 1;
+  }
+  return __builtin_ctz(mask);
+}
+
+// random moves until the game is over -> X == 1, O == 0, draw == -1
+static int8_t mctsPlayout(Board b){
+  int8_t winner = bbWinner(b);
+  if(winner != -1)
+    return winner;
+  uint16_t empty = bbEmpty(b);
+  bool xTurn = bbXTurn(b);
+  while(empty){
+    uint16_t bit = bbBit(mctsNth(empty, rngBelow(mctsRng, bbCount(empty))));
+    empty &= ~bit;
+    uint16_t &mine = xTurn ? b.x : b.o;
+    mine |= bit;
+    if(bbHasLine(mine))
+      return xTurn;
+    xTurn = !xTurn;
+  }
+  return -1;
+}
+
+static uint16_t mctsSelectChild(const MctsNode &parent){
+  float logVisits = logf(parent.visits);
+  float best = -1;
+  uint16_t bestChild = parent.child;
+  for(uint16_t c = parent.child; c; c = mctsArena[c].sibling){
+    const MctsNode &n = mctsArena[c];
+    float value = n.score / (2.0f * n.visits) + MCTS_EXPLORE * sqrtf(logVisits / n.visits);
+    if(value > best){
+      best = value;
+      bestChild = c;
+    }
+  }
+  return bestChild;
+}
+
+// select, expand, play out and back up once
+static void mctsIterate(){
+  uint16_t path[MCTS_PATH];
+  uint8_t depth = 0;
+  Board board = mctsRootBoard;
+  uint16_t node = 0;
+  path[depth++] = 0;
+
+  for(;;){
+    MctsNode &n = mctsArena[node];
+    if(n.untried){
+      // expand one untried cell, or play out from here once the arena is
+      // full, see mcts.h for why this does not go on down the children
+      uint8_t cell = mctsNth(n.untried, rngBelow(mctsRng, bbCount(n.untried)));
+      Board child = board;
+      bbPlace(child, cell, bbXTurn(board));
+      uint16_t c = mctsAlloc(cell, child);
+      if(c){
+        n.untried &= ~bbBit(cell);
+        mctsArena[c].sibling = n.child;
+        n.child = c;
+        path[depth++] = c;
+        board = child;
+      }
+      break;
+    }
+    if(!n.child){
+      // game over
+      break;
+    }
+    node = mctsSelectChild(n);
+    bbPlace(board, mctsArena[node].move, bbXTurn(board));
+    path[depth++] = node;
+  }
+
+  int8_t winner = mctsPlayout(board);
+  // the root's side moved into the nodes at odd depths
+  uint8_t rootSide = bbXTurn(mctsRootBoard);
+  for(uint8_t d = 0; d < depth; d++){
+    MctsNode &n = mctsArena[path[d]];
+    uint8_t mover = (d & 1) ? rootSide : !rootSide;
+    n.visits++;
+    if(winner == -1){
+      n.score += 1;
+    }else if(winner == mover){
+      n.score += 2;
+    }
+  }
+  mctsCount++;
+}
+
+// live nodes below index i, their new index after compaction
+static uint16_t mctsRank(const uint8_t *live, uint16_t i){
+  uint16_t rank = 0;
+  for(uint16_t j = 0; j < i; j++){
+    if(live[j >> 3] & (1 << (j & 7)))
+      rank++;
+  }
+  return rank;
+}
+
+// keep only the subtree of node and slide it to the front of the arena,
+// children always come after their parent so one forward pass does
+static void mctsKeep(uint16_t node, const Board &board){
+  uint8_t live[(MCTS_NODES + 7) / 8] = {};
+  live[node >> 3] |= 1 << (node & 7);
+  for(uint16_t i = node; i < mctsUsed; i++){
+    if(!(live[i >> 3] & (1 << (i & 7))))
+      continue;
+    for(uint16_t c = mctsArena[i].child; c; c = mctsArena[c].sibling)
+      live[c >> 3] |= 1 << (c & 7);
+  }
+  uint16_t used = 0;
+  for(uint16_t i = node; i < mctsUsed; i++){
+    if(!(live[i >> 3] & (1 << (i & 7))))
+      continue;
+    MctsNode n = mctsArena[i];
+    if(n.child)
+      n.child = mctsRank(live, n.child);
+    if(n.sibling)
+      n.sibling = mctsRank(live, n.sibling);
+    mctsArena[used++] = n;
+  }
+  mctsArena[0].sibling = 0;
+  mctsUsed = used;
+  mctsRootBoard = board;
+}
+
+// node one or two plies below the root that reaches board, 0 if none
+static uint16_t mctsFind(const Board &board){
+  bool xTurn = bbXTurn(mctsRootBoard);
+  for(uint16_t c = mctsArena[0].child; c; c = mctsArena[c].sibling){
+    Board b = mctsRootBoard;
+    bbPlace(b, mctsArena[c].move, xTurn);
+    if(bbEqual(b, board))
+      return c;
+    for(uint16_t g = mctsArena[c].child; g; g = mctsArena[g].sibling){
+      Board bg = b;
+      bbPlace(bg, mctsArena[g].move, !xTurn);
+      if(bbEqual(bg, board))
+        return g;
+    }
+  }
+  return 0;
+}
+
+void mctsSeed(uint32_t seed){
+  rngSeed(mctsRng, seed);
+}
+
+void mctsBegin(const Board &board, uint16_t playouts){
+  if(!mctsRng.state)
+    rngSeed(mctsRng, 0);
+  mctsReused = 0;
+  if(mctsUsed && bbEqual(board, mctsRootBoard)){
+    mctsReused = mctsUsed;
+  }else{
+    uint16_t node = mctsUsed ? mctsFind(board) : 0;
+    if(node){
+      mctsKeep(node, board);
+      mctsReused = mctsUsed;
+    }else{
+      mctsReset(board);
+    }
+  }
+  // 16 bit int on AVR, add them up wider before clamping
+  uint32_t target = (uint32_t)mctsArena[0].visits + playouts;
+  mctsTarget = target < MCTS_MAX_VISITS ? target : MCTS_MAX_VISITS;
+  mctsCount = 0;
+  mctsBusy = true;
+}
+
+bool mctsStep(unsigned long budgetUs){
+  unsigned long start = micros();
+  while(mctsBusy){
+    if(mctsArena[0].visits >= mctsTarget || (!mctsArena[0].untried && !mctsArena[0].child)){
+      mctsBusy = false;
+      break;
+    }
+    mctsIterate();
+    if(micros() - start >= budgetUs)
+      break;
+  }
+  return !mctsBusy;
+}
+
+bool mctsRunning(){
+  return mctsBusy;
+}
+
+int mctsMove(){
+  int best = -1;
+  uint16_t bestVisits = 0, bestScore = 0;
+  for(uint16_t c = mctsArena[0].child; c; c = mctsArena[c].sibling){
+    const MctsNode &n = mctsArena[c];
+    if(best == -1 || n.visits > bestVisits || (n.visits == bestVisits && n.score > bestScore)){
+      best = n.move;
+      bestVisits = n.visits;
+      bestScore = n.score;
+    }
+  }
+  return best;
+}
+
+float mctsValue(){
+  int move = mctsMove();
+  for(uint16_t c = mctsArena[0].child; c; c = mctsArena[c].sibling){
+    const MctsNode &n = mctsArena[c];
+    if(n.move == move)
+      return n.score / (2.0f * n.visits);
+  }
+  return -1;
+}
+
+unsigned long mctsPlayouts(){
+  return mctsCount;
+}
+uint16_t mctsNodesUsed(){
+  return mctsUsed;
+}
+uint16_t mctsNodesReused(){
+  return mctsReused;
+}
@@ -0,0 +1,69 @@
+#include "mnk.h"
+#include "book4.h"
+
+// the book is 43KB of flash, only builds that call mnkBook4() link it in
+
+namespace {
+
+const uint8_t BOOK4_SIDE = 4;
+
+// same symmetry order as bitboard.h and tools/solver4
+uint8_t book4Cell(uint8_t cell, uint8_t sym){
+  uint8_t x = cell / BOOK4_SIDE, y = cell % BOOK4_SIDE;
+  if(sym & 1)
+    y = BOOK4_SIDE - 1 - y;
+  if(sym & 2)
+    x = BOOK4_SIDE - 1 - x;
+  if(sym & 4){
+    uint8_t t = x;
+    x = y;
+    y = t;
+  }
+  return x*BOOK4_SIDE + y;
+}
+uint32_t book4Transform(uint32_t m, uint8_t sym){
+  uint32_t out = 0;
+  for(uint8_t c = 0; c < BOOK4_SIDE*BOOK4_SIDE; c++){
+    if(m & ((uint32_t)1 << c))
+      out |= (uint32_t)1 << book4Cell(c, sym);
+  }
+  return out;
+}
+
+}
+
+bool mnkBook4(uint32_t x, uint32_t o, uint8_t &cell, uint8_t &result, uint8_t &plies){
+  if(mnkCount(x) + mnkCount(o) > BOOK4_PLIES)
+    return false;
+  uint32_t key = x << 16 | o;
+  uint8_t sym = 0;
+  for(uint8_t s = 1; s < 8; s++){
+    uint32_t k = book4Transform(x, s) << 16 | book4Transform(o, s);
+    if(k < key){
+      key = k;
+      sym = s;
+    }
+  }
+
+  uint16_t lo = 0, hi = BOOK4_SIZE;
+  while(lo < hi){
+    uint16_t mid = lo + (hi - lo) / 2;
+    if(pgm_read_dword(&BOOK4_KEYS[mid]) < key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if(lo == BOOK4_SIZE || pgm_read_dword(&BOOK4_KEYS[lo]) != key)
+    return false;
+
+  uint16_t info = pgm_read_word(&BOOK4_INFO[lo]);
+  // the stored cell is in the canonical orientation, turn it back
+  uint8_t canonical = info & 0x0F;
+  for(uint8_t c = 0; c < BOOK4_SIDE*BOOK4_SIDE; c++){
+    if(book4Cell(c, sym) == canonical)
+      cell = c;
+  }
+  result = (info >> 4) & 3;
+  plies = (info >> 6) & 0x1F;
+  return true;
+}
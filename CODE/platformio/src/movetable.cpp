@@ -0,0 +1,92 @@
+#include "movetable.h"
+
+// the whole table is solved by the compiler and written straight to flash,
+// build with -D TTT_RUNTIME_SEARCH to drop it and search at runtime instead
+#ifndef TTT_RUNTIME_SEARCH
+
+namespace {
+
+constexpr bool mtHasLine(uint16_t mask){
+  for(uint8_t i = 0; i < BB_NUM_LINES; i++){
+    if((mask & BB_LINES[i]) == BB_LINES[i])
+      return true;
+  }
+  return false;
+}
+constexpr uint8_t mtCount(uint16_t mask){
+  uint8_t n = 0;
+  for(; mask; mask &= mask - 1)
+    n++;
+  return n;
+}
+constexpr uint8_t mtEntry(uint8_t result, uint8_t cell){
+  return (uint8_t)(result << 4 | cell);
+}
+// flip a child's result to the parent's point of view, one ply further away
+constexpr uint8_t mtParentResult(uint8_t child){
+  return child >= MT_LOSS ? (uint8_t)(MT_WIN + child - MT_LOSS)
+       : child != MT_DRAW ? (uint8_t)(MT_LOSS + child)
+       : MT_DRAW;
+}
+// bigger is better: quick wins, then slow wins, draws, slow losses, quick losses
+constexpr int mtRank(uint8_t result){
+  return result >= MT_LOSS ? result - MT_LOSS
+       : result != MT_DRAW ? 100 - result
+       : 50;
+}
+
+constexpr MoveTable buildMoveTable(){
+  MoveTable t{};
+  // every child has a bigger index than its parent, so walking down from
+  // the last index always finds the children already solved
+  for(int32_t idx = MT_POSITIONS - 1; idx >= 0; idx--){
+    uint16_t x = 0, o = 0;
+    uint16_t rest = (uint16_t)idx;
+    for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+      uint8_t digit = rest % 3;
+      rest /= 3;
+      if(digit == 1)
+        x |= bbBit(cell);
+      else if(digit == 2)
+        o |= bbBit(cell);
+    }
+    uint8_t xCount = mtCount(x);
+    uint8_t oCount = mtCount(o);
+    uint16_t empty = ~(x | o) & BB_FULL;
+
+    if(xCount != oCount && xCount != oCount + 1){
+      t.entry[idx] = mtEntry(MT_DRAW, MT_NO_MOVE); // can not be reached
+      continue;
+    }
+    if(mtHasLine(x) || mtHasLine(o)){
+      t.entry[idx] = mtEntry(MT_LOSS, MT_NO_MOVE); // the last move won
+      continue;
+    }
+    if(!empty){
+      t.entry[idx] = mtEntry(MT_DRAW, MT_NO_MOVE);
+      continue;
+    }
+
+    uint16_t digit = xCount == oCount ? 1 : 2;
+    uint8_t bestCell = MT_NO_MOVE;
+    uint8_t bestResult = MT_DRAW;
+    for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+      if(!(empty & bbBit(cell)))
+        continue;
+      uint8_t child = mtResult(t.entry[idx + digit*MT_POW3[cell]]);
+      uint8_t result = mtParentResult(child);
+      if(bestCell == MT_NO_MOVE || mtRank(result) > mtRank(bestResult)){
+        bestCell = cell;
+        bestResult = result;
+      }
+    }
+    t.entry[idx] = mtEntry(bestResult, bestCell);
+  }
+  return t;
+}
+
+}
+
+constexpr MoveTable MOVE_TABLE PROGMEM = buildMoveTable();
+
+#endif
@@ -0,0 +1,127 @@
+#include "profile.h"
+
+#ifdef TTT_PROFILE
+
+#include "hal.h"
+#ifdef ARDUINO
+#include <util/atomic.h>
+#endif
+
+const uint8_t CYCLES_PER_US = F_CPU / 1000000UL;
+
+ProfileDump prof;
+volatile uint16_t profHigh; // Timer5 overflows
+bool profPending;           // a press is waiting to be shown
+uint16_t profPressTime;
+
+static void profClear(ProfStat &s){
+  s.count = 0;
+  s.min = UINT32_MAX;
+  s.max = 0;
+  s.total = 0;
+}
+static void profAdd(ProfStat &s, uint32_t v){
+  s.count++;
+  s.total += v;
+  if(v < s.min)
+    s.min = v;
+  if(v > s.max)
+    s.max = v;
+}
+static void profReset(){
+  memset(&prof, 0, sizeof(prof));
+  prof.magic[0] = 'T';
+  prof.magic[1] = 'P';
+  prof.version = PROF_VERSION;
+  prof.size = sizeof(prof);
+  profClear(prof.search);
+  profClear(prof.draw);
+  profClear(prof.isr);
+  profClear(prof.frame);
+  profClear(prof.latency);
+}
+
+void profBegin(){
+  profReset();
+#ifdef ARDUINO
+  // Timer5 free running at clk/1, the overflow supplies the top 16 bits
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+    TCCR5A = 0;
+    TCCR5B = (1 << CS50);
+    TCNT5 = 0;
+    TIMSK5 |= (1 << TOIE5);
+  }
+#endif
+}
+
+#ifdef ARDUINO
+ISR(TIMER5_OVF_vect){
+  profHigh++;
+}
+
+uint32_t profCycles(){
+  uint16_t high, low;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+    low = TCNT5;
+    high = profHigh;
+    // overflowed but the interrupt has not run yet
+    if((TIFR5 & (1 << TOV5)) && low < 0x8000)
+      high++;
+  }
+  return (uint32_t)high << 16 | low;
+}
+#else
+uint32_t profCycles(){
+  return micros() * CYCLES_PER_US;
+}
+#endif
+
+void profSearch(uint32_t cycles, uint32_t nodes){
+  profAdd(prof.search, cycles);
+  prof.searchNodes += nodes;
+  if(nodes > prof.searchNodesMax)
+    prof.searchNodesMax = nodes;
+}
+void profDraw(uint32_t cycles){
+  profAdd(prof.draw, cycles);
+}
+void profIsr(uint32_t cycles){
+  profAdd(prof.isr, cycles);
+}
+void profFrame(uint32_t cycles){
+  profAdd(prof.frame, cycles);
+  uint32_t us = cycles / CYCLES_PER_US;
+  uint8_t bin = 0;
+  while(us && bin < PROF_HIST_BINS - 1){
+    us >>= 1;
+    bin++;
+  }
+  if(prof.frameHist[bin] != UINT16_MAX)
+    prof.frameHist[bin]++;
+}
+void profPress(uint16_t pressTime){
+  profPending = true;
+  profPressTime = pressTime;
+}
+void profShown(){
+  if(!profPending)
+    return;
+  profPending = false;
+  profAdd(prof.latency, (uint16_t)((uint16_t)millis() - profPressTime));
+}
+
+bool profSnapshot(ProfileDump &out){
+#ifdef ARDUINO
+  // the display interrupt updates prof.isr
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+    out = prof;
+    profReset();
+  }
+#else
+  out = prof;
+  profReset();
+#endif
+  return true;
+}
+
+#endif
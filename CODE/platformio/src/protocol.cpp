@@ -0,0 +1,330 @@
+#include "hal.h"
+#include "protocol.h"
+#include "budget.h"
+#include "bitboard.h"
+#include "movetable.h"
+#include "search.h"
+#include "profile.h"
+#include "gamelog.h"
+
+#include <stddef.h>
+#ifdef ARDUINO
+#include <util/crc16.h>
+#endif
+
+static_assert(3 + 3*PROTO_MAX_BATCH + 2 <= PROTO_MAX_PAYLOAD, "a full batch must fit one frame");
+static_assert(PROTO_MAX_PAYLOAD < 254, "frames are one COBS block");
+
+const uint16_t PROTO_TX_SIZE = PROTO_TX_BUFFER + 1;
+const uint8_t PROTO_FRAME_OVERHEAD = 2 + 2 + 3; // type seq, crc, COBS code and two zeros
+const uint8_t PROTO_LOG_MAX = 64;
+#ifdef TTT_RUNTIME_SEARCH
+const unsigned long protoSliceTime = 1000; // us of search per loop(), like aiTask()
+#endif
+
+// receive -> the core's interrupt fills Serial's ring, this collects one frame
+uint8_t rxFrame[PROTO_MAX_PAYLOAD + 1];
+uint8_t rxLength;
+bool rxOverflow;
+
+// transmit -> frames are queued here and handed to Serial as it has room
+uint8_t txRing[PROTO_TX_SIZE];
+uint8_t txHead;
+uint8_t txTail;
+uint8_t txCodeAt; // COBS code byte of the block being written
+uint8_t txCode;
+uint16_t txCrc;
+
+// the batch being answered
+uint8_t evalSeq;
+uint8_t evalCount;
+uint8_t evalNext;     // next position to evaluate
+uint8_t evalFirst;    // first position of the pending reply
+uint8_t evalPositions[3*PROTO_MAX_BATCH];
+uint8_t evalResults[2*PROTO_REPLY_CHUNK];
+#ifdef TTT_RUNTIME_SEARCH
+bool evalSearching;
+#endif
+static_assert(sizeof(rxFrame) + sizeof(txRing) + sizeof(evalPositions) + sizeof(evalResults) <= BUDGET_PROTOCOL,
+              "protocol is over its SRAM budget, see budget.h");
+
+uint16_t protoCrc(uint16_t crc, uint8_t data){
+#ifdef ARDUINO
+  return _crc_xmodem_update(crc, data);
+#else
+  crc ^= (uint16_t)data << 8;
+  for(uint8_t i = 0; i < 8; i++){
+    crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+#endif
+}
+
+static uint8_t txFree(){
+  return (uint8_t)(txTail - txHead - 1 + PROTO_TX_SIZE) % PROTO_TX_SIZE;
+}
+static void txPut(uint8_t b){
+  txRing[txHead] = b;
+  txHead = (txHead + 1) % PROTO_TX_SIZE;
+}
+// COBS encoder writing straight into the ring
+static void txFrameByte(uint8_t b){
+  txCrc = protoCrc(txCrc, b);
+  if(b == 0){
+    txRing[txCodeAt] = txCode;
+    txCodeAt = txHead;
+    txPut(0);
+    txCode = 1;
+  }else{
+    txPut(b);
+    txCode++;
+  }
+}
+static bool txBegin(uint8_t type, uint8_t seq, uint8_t length){
+  if(txFree() < length + PROTO_FRAME_OVERHEAD)
+    return false;
+  // a leading zero ends anything half sent, so the frame always parses
+  txPut(0);
+  txCodeAt = txHead;
+  txPut(0);
+  txCode = 1;
+  txCrc = 0xFFFF;
+  txFrameByte(type);
+  txFrameByte(seq);
+  return true;
+}
+static void txEnd(){
+  uint16_t crc = txCrc;
+  txFrameByte(crc & 0xFF);
+  txFrameByte(crc >> 8);
+  txRing[txCodeAt] = txCode;
+  txPut(0);
+}
+static bool protoSend(uint8_t type, uint8_t seq, const uint8_t *body, uint8_t length){
+  if(!txBegin(type, seq, length))
+    return false;
+  for(uint8_t i = 0; i < length; i++)
+    txFrameByte(body[i]);
+  txEnd();
+  return true;
+}
+static bool gamesSend(uint8_t seq, uint16_t back, uint8_t count){
+  uint16_t stored = glogStored();
+  if(back >= stored)
+    count = 0;
+  else if(count > stored - back)
+    count = stored - back;
+  if(!txBegin(PROTO_GAMES_REPLY, seq, 3 + 4*count))
+    return false;
+  txFrameByte(back & 0xFF);
+  txFrameByte(back >> 8);
+  txFrameByte(count);
+  for(uint8_t i = 0; i < count; i++){
+    uint32_t record = glogRecord(back + i);
+    for(uint8_t b = 0; b < 4; b++)
+      txFrameByte(record >> (8*b));
+  }
+  txEnd();
+  return true;
+}
+static void protoNak(uint8_t seq, uint8_t code){
+  protoSend(PROTO_NAK, seq, &code, 1);
+}
+
+void protoLog(const char *msg){
+  size_t length = strlen(msg);
+  if(length > PROTO_LOG_MAX)
+    length = PROTO_LOG_MAX;
+  protoSend(PROTO_LOG, 0, (const uint8_t *)msg, length);
+}
+
+static bool evalLegal(const Board &b){
+  if((b.x & b.o) || (b.x | b.o) > BB_FULL)
+    return false;
+  uint8_t x = bbCount(b.x), o = bbCount(b.o);
+  if(x != o && x != o + 1)
+    return false;
+  // nobody moves after a win, so the winner made the last move
+  if(bbHasLine(b.x) && x != o + 1)
+    return false;
+  if(bbHasLine(b.o) && x != o)
+    return false;
+  return true;
+}
+// true once move and score are known, the runtime search can take a while
+static bool evalPosition(const Board &b, uint8_t &move, int8_t &score){
+  move = PROTO_NO_MOVE;
+  score = 0;
+  if(!evalLegal(b))
+    return true;
+  if(bbWinner(b) != -1 || !bbEmpty(b)){
+    score = bbWinner(b) == 1 ? 10 : bbWinner(b) == 0 ? -10 : 0;
+    return true;
+  }
+#ifdef TTT_RUNTIME_SEARCH
+  // the game's AI comes first, it takes the search over if it needs it
+  if(!evalSearching){
+    if(searchRunning())
+      return false;
+    searchBegin(b);
+    evalSearching = true;
+  }
+  if(!bbEqual(searchRoot(), b) || searchLimit() != SEARCH_FULL){
+    evalSearching = false;
+    return false;
+  }
+  if(searchRunning() && !searchStep(protoSliceTime))
+    return false;
+  evalSearching = false;
+  move = searchMove();
+  score = searchScore();
+#else
+  uint8_t e = mtLookup(b);
+  move = mtMove(e);
+  score = bbXTurn(b) ? mtScore(e) : -mtScore(e);
+#endif
+  return true;
+}
+
+static void evalPoll(){
+  while(evalFirst < evalCount){
+    uint8_t done = evalNext - evalFirst;
+    if(evalNext < evalCount && done < PROTO_REPLY_CHUNK){
+      const uint8_t *p = &evalPositions[3*evalNext];
+      uint32_t packed = p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16;
+      Board b = {(uint16_t)(packed & 0x1FF), (uint16_t)(packed >> 9)};
+      uint8_t move;
+      int8_t score;
+      if(!evalPosition(b, move, score))
+        return;
+      evalResults[2*done] = move;
+      evalResults[2*done + 1] = (uint8_t)score;
+      evalNext++;
+      continue;
+    }
+    // a chunk is full or the batch is done -> send it once there is room
+    if(!txBegin(PROTO_EVAL_REPLY, evalSeq, 2 + 2*done))
+      return;
+    txFrameByte(evalFirst);
+    txFrameByte(done);
+    for(uint8_t i = 0; i < 2*done; i++)
+      txFrameByte(evalResults[i]);
+    txEnd();
+    evalFirst = evalNext;
+  }
+}
+
+static void rxDispatch(){
+  // decode COBS in place, a zero byte inside a frame means it is corrupt
+  uint8_t length = 0;
+  uint8_t i = 0;
+  while(i < rxLength){
+    uint8_t code = rxFrame[i++];
+    if(code == 0 || i + code - 1 > rxLength){
+      protoNak(0, PROTO_ERR_CRC);
+      return;
+    }
+    for(uint8_t j = 1; j < code; j++)
+      rxFrame[length++] = rxFrame[i++];
+    if(code != 0xFF && i < rxLength)
+      rxFrame[length++] = 0;
+  }
+  if(length < 4){
+    protoNak(0, PROTO_ERR_CRC);
+    return;
+  }
+  uint16_t crc = 0xFFFF;
+  for(i = 0; i < length - 2; i++)
+    crc = protoCrc(crc, rxFrame[i]);
+  if(crc != (rxFrame[length-2] | (uint16_t)rxFrame[length-1] << 8)){
+    protoNak(0, PROTO_ERR_CRC);
+    return;
+  }
+
+  uint8_t type = rxFrame[0];
+  uint8_t seq = rxFrame[1];
+  const uint8_t *body = &rxFrame[2];
+  uint8_t bodyLength = length - 4;
+  switch(type){
+    case(PROTO_EVAL):
+      if(evalFirst < evalCount){
+        protoNak(seq, PROTO_ERR_BUSY);
+      }else if(bodyLength < 1 || body[0] == 0 || body[0] > PROTO_MAX_BATCH || bodyLength != 1 + 3*body[0]){
+        protoNak(seq, PROTO_ERR_LENGTH);
+      }else{
+        memcpy(evalPositions, &body[1], 3*body[0]);
+        evalSeq = seq;
+        evalCount = body[0];
+        evalNext = 0;
+        evalFirst = 0;
+      }
+      break;
+
+    case(PROTO_PROFILE): {
+      ProfileDump dump;
+      if(!profSnapshot(dump)){
+        protoNak(seq, PROTO_ERR_TYPE);
+      }else if(!protoSend(PROTO_PROFILE_REPLY, seq, (const uint8_t *)&dump, sizeof(dump))){
+        protoNak(seq, PROTO_ERR_BUSY);
+      }
+      break;
+    }
+
+    case(PROTO_STATS):
+      if(!protoSend(PROTO_STATS_REPLY, seq, (const uint8_t *)&glogTotals(), offsetof(GlogTotals, crc))){
+        protoNak(seq, PROTO_ERR_BUSY);
+      }
+      break;
+
+    case(PROTO_GAMES):
+      if(bodyLength != 3 || body[2] > PROTO_MAX_GAMES){
+        protoNak(seq, PROTO_ERR_LENGTH);
+      }else if(!gamesSend(seq, body[0] | (uint16_t)body[1] << 8, body[2])){
+        protoNak(seq, PROTO_ERR_BUSY);
+      }
+      break;
+
+    default:
+      protoNak(seq, PROTO_ERR_TYPE);
+      break;
+  }
+}
+
+static void rxPoll(){
+  while(Serial.available() > 0){
+    uint8_t b = Serial.read();
+    if(b != 0){
+      if(rxLength < sizeof(rxFrame)){
+        rxFrame[rxLength++] = b;
+      }else{
+        rxOverflow = true;
+      }
+      continue;
+    }
+    if(rxOverflow){
+      protoNak(0, PROTO_ERR_LENGTH);
+    }else if(rxLength){
+      rxDispatch();
+    }
+    rxLength = 0;
+    rxOverflow = false;
+  }
+}
+
+static void txPoll(){
+  int room = Serial.availableForWrite();
+  while(room-- > 0 && txTail != txHead){
+    Serial.write(txRing[txTail]);
+    txTail = (txTail + 1) % PROTO_TX_SIZE;
+  }
+}
+
+void protoBegin(){
+  Serial.begin(PROTO_BAUD);
+}
+
+void protoPoll(){
+  rxPoll();
+  evalPoll();
+  txPoll();
+}
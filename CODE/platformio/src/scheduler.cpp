@@ -0,0 +1,70 @@
+#include "hal.h"
+#include "scheduler.h"
+#include "budget.h"
+
+SchedTask schedTasks[SCHED_MAX_TASKS];
+SchedFn schedFns[SCHED_MAX_TASKS];
+const char *schedNames[SCHED_MAX_TASKS];
+uint8_t schedTaskCount;
+static_assert(sizeof(schedTasks) + sizeof(schedTaskCount) <= BUDGET_SCHED,
+              "scheduler is over its SRAM budget, see budget.h");
+
+static uint16_t schedClamp(uint32_t us){
+  return us > UINT16_MAX ? UINT16_MAX : (uint16_t)us;
+}
+
+uint8_t schedAdd(const char *name, SchedFn run, uint32_t periodUs, uint32_t offsetUs){
+  if(schedTaskCount == SCHED_MAX_TASKS)
+    return SCHED_MAX_TASKS;
+  SchedTask &t = schedTasks[schedTaskCount];
+  schedFns[schedTaskCount] = run;
+  schedNames[schedTaskCount] = name;
+  t.period = periodUs;
+  t.due = micros() + offsetUs;
+  t.maxLate = 0;
+  t.maxRun = 0;
+  t.overruns = 0;
+  return schedTaskCount++;
+}
+
+uint8_t schedRun(){
+  uint8_t ran = 0;
+  for(uint8_t i = 0; i < schedTaskCount; i++){
+    SchedTask &t = schedTasks[i];
+    uint32_t start = micros();
+    if(!schedDue(start, t.due))
+      continue;
+    uint32_t late = start - t.due;
+    schedFns[i]();
+    ran++;
+    uint32_t end = micros();
+    if(late > t.maxLate)
+      t.maxLate = schedClamp(late);
+    if(end - start > t.maxRun)
+      t.maxRun = schedClamp(end - start);
+    t.due += t.period;
+    if(schedDue(end, t.due)){
+      // missed at least one tick, start again from now
+      t.overruns++;
+      t.due = end + t.period;
+    }
+  }
+  return ran;
+}
+
+uint8_t schedCount(){
+  return schedTaskCount;
+}
+const SchedTask &schedTask(uint8_t id){
+  return schedTasks[id];
+}
+const char *schedName(uint8_t id){
+  return schedNames[id];
+}
+void schedClear(){
+  for(uint8_t i = 0; i < schedTaskCount; i++){
+    schedTasks[i].maxLate = 0;
+    schedTasks[i].maxRun = 0;
+    schedTasks[i].overruns = 0;
+  }
+}
@@ -0,0 +1,242 @@
+#include "hal.h"
+#include "search.h"
+#include "budget.h"
+#include "searchstate.h"
+#include "ttable.h"
+
+static_assert(SEARCH_STACK > BB_CELLS, "search stack must hold one frame per empty cell plus the root");
+
+// check the clock every few nodes, micros() is not free on AVR
+const uint8_t SEARCH_CLOCK_NODES = 8;
+const uint8_t SEARCH_KILLERS = 2;
+// ordering stages -> TT move, the killers, then SEARCH_ORDER
+const uint8_t SEARCH_STAGES = 1 + SEARCH_KILLERS + BB_CELLS;
+
+HAL_THREAD_LOCAL SearchState searchState;
+HAL_THREAD_LOCAL Board searchRootBoard;
+HAL_THREAD_LOCAL SearchFrame searchStack[SEARCH_STACK];
+HAL_THREAD_LOCAL int8_t searchKillers[SEARCH_STACK][SEARCH_KILLERS]; // cells that caused a cut, per ply
+HAL_THREAD_LOCAL uint8_t searchDepth;   // frame on top of the stack
+HAL_THREAD_LOCAL uint8_t searchMaxDepth;
+HAL_THREAD_LOCAL bool searchEnter;      // top frame has not been looked at yet
+HAL_THREAD_LOCAL bool searchBusy;
+HAL_THREAD_LOCAL int searchReturn;      // value handed from a finished frame to its parent
+HAL_THREAD_LOCAL int searchBestMove;
+HAL_THREAD_LOCAL int searchBestScore;
+HAL_THREAD_LOCAL unsigned long searchCount;
+static_assert(sizeof(searchStack) + sizeof(searchKillers) + sizeof(searchState) + sizeof(searchRootBoard) <= BUDGET_SEARCH,
+              "search is over its SRAM budget, see budget.h");
+
+// scores are from the side to move, the TT is only used when they are exact
+static bool searchExact(){
+  return searchMaxDepth >= SEARCH_FULL;
+}
+
+static void searchPush(int alpha, int beta){
+  SearchFrame &f = searchStack[searchDepth];
+  f.alpha = alpha;
+  f.beta = beta;
+  f.alphaStart = alpha;
+  f.tried = 0;
+  f.best = -1;
+  f.hashMove = -1;
+  f.current = -1;
+  f.next = 0;
+  f.scout = 0;
+  searchEnter = true;
+}
+static void searchPop(int value, int move){
+  if(searchDepth == 0){
+    // back to the utility() scale, X wins > 0
+    searchBestScore = searchState.xTurn ? value : -value;
+    searchBestMove = move;
+    searchBusy = false;
+    return;
+  }
+  searchDepth--;
+  searchReturn = value;
+}
+
+// first time a frame is looked at, true if it is already done
+static bool searchOpen(SearchFrame &f){
+  searchCount++;
+  if(searchState.winner != -1){
+    // the side that just moved has won
+    searchPop(-(SEARCH_WIN - searchDepth), -1);
+    return true;
+  }
+  if(searchState.empties == 0 || searchDepth >= searchMaxDepth){
+    searchPop(0, -1);
+    return true;
+  }
+
+  // mate distance -> nothing here beats winning with the next move or is
+  // worse than having lost already
+  if(f.alpha < -(SEARCH_WIN - searchDepth))
+    f.alpha = -(SEARCH_WIN - searchDepth);
+  if(f.beta > SEARCH_WIN - searchDepth - 1)
+    f.beta = SEARCH_WIN - searchDepth - 1;
+  if(f.alpha >= f.beta){
+    searchPop(f.alpha, -1);
+    return true;
+  }
+  f.alphaStart = f.alpha;
+
+  uint8_t bound, cell;
+  int value;
+  if(!searchExact() || !ttProbe(searchState.board, searchDepth, bound, value, cell))
+    return false;
+  if(cell < BB_CELLS)
+    f.hashMove = cell;
+  // the root must come back with a move
+  if(searchDepth == 0 && f.hashMove == -1)
+    return false;
+  // transposition table cut -> same fail-hard result the search would give
+  if(bound == TT_LOWER && value >= f.beta){
+    value = f.beta;
+  }else if(bound == TT_UPPER && value <= f.alpha){
+    value = f.alpha;
+  }else if(bound == TT_EXACT){
+    if(value > f.beta)
+      value = f.beta;
+    if(value < f.alpha)
+      value = f.alpha;
+  }else{
+    return false;
+  }
+  searchPop(value, f.hashMove);
+  return true;
+}
+
+// next cell to search below f in ordering stages, -1 when there is none
+static int8_t searchNextMove(SearchFrame &f){
+  uint16_t open = bbEmpty(searchState.board) & ~f.tried;
+  while(f.next < SEARCH_STAGES){
+    uint8_t stage = f.next++;
+    int8_t cell;
+    if(stage == 0){
+      cell = f.hashMove;
+    }else if(stage <= SEARCH_KILLERS){
+      cell = searchKillers[searchDepth][stage - 1];
+    }else{
+      cell = pgm_read_byte(&SEARCH_ORDER[stage - 1 - SEARCH_KILLERS]);
+    }
+    if(cell != -1 && (open & bbBit(cell))){
+      f.tried |= bbBit(cell);
+      return cell;
+    }
+  }
+  return -1;
+}
+
+static void searchKiller(int8_t cell){
+  int8_t *killers = searchKillers[searchDepth];
+  if(killers[0] != cell){
+    killers[1] = killers[0];
+    killers[0] = cell;
+  }
+}
+
+// one visit of the top frame: enter it, take a child's result or open the
+// next child
+static void searchVisit(){
+  SearchFrame &f = searchStack[searchDepth];
+
+  if(searchEnter){
+    searchEnter = false;
+    if(searchOpen(f))
+      return;
+  }
+
+  int8_t cell = f.current;
+  if(cell != -1){
+    int value = -searchReturn;
+    if(f.scout && value > f.alpha && value < f.beta){
+      // the null window says it beats the best move, get its real score
+      f.scout = 0;
+      searchDepth++;
+      searchPush(-f.beta, -f.alpha);
+      return;
+    }
+    f.current = -1;
+    ssUnmake(searchState, cell);
+    if(value >= f.beta){
+      if(searchExact())
+        ttStore(searchState.board, searchDepth, TT_LOWER, f.beta, cell);
+      searchKiller(cell);
+      searchPop(f.beta, cell);
+      return;
+    }
+    if(value > f.alpha || f.best == -1){
+      if(value > f.alpha)
+        f.alpha = value;
+      f.best = cell;
+    }
+  }
+
+  bool first = !f.tried;
+  cell = searchNextMove(f);
+  if(cell != -1){
+    f.current = cell;
+    f.scout = !first;
+    ssMake(searchState, cell);
+    searchDepth++;
+    if(first){
+      searchPush(-f.beta, -f.alpha);
+    }else{
+      searchPush(-f.alpha - 1, -f.alpha);
+    }
+    return;
+  }
+
+  // every child searched
+  if(searchExact())
+    ttStore(searchState.board, searchDepth, f.alpha > f.alphaStart ? TT_EXACT : TT_UPPER, f.alpha, f.best);
+  searchPop(f.alpha, f.best);
+}
+
+void searchBegin(const Board &board, uint8_t depth){
+  searchRootBoard = board;
+  searchMaxDepth = depth;
+  memset(searchKillers, -1, sizeof(searchKillers));
+  ssInit(searchState, board);
+  searchDepth = 0;
+  searchCount = 0;
+  searchBestMove = -1;
+  searchBestScore = 0;
+  searchBusy = true;
+  searchPush(-SEARCH_INF, SEARCH_INF);
+}
+
+bool searchStep(unsigned long budgetUs){
+  unsigned long start = micros();
+  uint8_t nodes = 0;
+  while(searchBusy){
+    searchVisit();
+    if(++nodes == SEARCH_CLOCK_NODES){
+      nodes = 0;
+      if(micros() - start >= budgetUs)
+        break;
+    }
+  }
+  return !searchBusy;
+}
+
+bool searchRunning(){
+  return searchBusy;
+}
+Board searchRoot(){
+  return searchRootBoard;
+}
+uint8_t searchLimit(){
+  return searchMaxDepth;
+}
+int searchMove(){
+  return searchBestMove;
+}
+int searchScore(){
+  return searchBestScore;
+}
+unsigned long searchNodes(){
+  return searchCount;
+}
@@ -0,0 +1,111 @@
+#include "hal.h"
+#include "session.h"
+#include "ai.h"
+#include "search.h"
+#include "mcts.h"
+
+// plies the search looks ahead per AI mode -> easy takes a win or blocks
+// one, medium also sees most forks coming
+const uint8_t aiModeDepth[AI_MODES] = {SEARCH_FULL, 0, 0, 2, 4};
+
+int checkWinner(const Board &board){
+  // X == 1, O == 0, no winner == -1
+  return bbWinner(board);
+}
+int utility(const Board &board){
+  int util = checkWinner(board);
+  if(util == 1){
+      return 10;
+  }else if(util == 0){
+      return -10;
+  }else{
+    return 0;
+  }
+}
+bool terminal(const Board &board){
+  // return if the game is over
+  // Returns True if game is over, False otherwise.
+  return bbEmpty(board) == 0 || checkWinner(board) != -1;
+}
+int userTurn(const Board &board){
+  // X == 1, O == 0
+  if(bbXTurn(board)){
+    return 1;
+  }else{
+    return 0;
+  }
+}
+
+void sessionBegin(GameSession &s, uint8_t aiMode, bool twoPlayer, bool aiX){
+  s.board = Board{0, 0};
+  s.winner = 0;
+  s.aiMode = aiMode;
+  s.twoPlayer = twoPlayer;
+  s.aiX = aiX;
+  s.over = false;
+}
+
+bool sessionPlay(GameSession &s, uint8_t cell){
+  if(s.over || cell >= BB_CELLS || !(bbEmpty(s.board) & bbBit(cell)))
+    return false;
+  bbPlace(s.board, cell, bbXTurn(s.board));
+  if(terminal(s.board)){
+    s.over = true;
+    s.winner = utility(s.board);
+  }
+  return true;
+}
+
+bool sessionAiToMove(const GameSession &s){
+  return !s.over && !s.twoPlayer && bbXTurn(s.board) == (bool)s.aiX;
+}
+
+static bool sessionSearch(const Board &board, uint8_t depth, unsigned long budgetUs, int &cell){
+  // the serial protocol may have left its own search running, take it over
+  if(!searchRunning() || !bbEqual(searchRoot(), board) || searchLimit() != depth)
+    searchBegin(board, depth);
+  if(!searchStep(budgetUs))
+    return false;
+  cell = searchMove();
+  return true;
+}
+
+bool sessionAiStep(GameSession &s, unsigned long budgetUs, int &cell){
+  switch(s.aiMode){
+    case AI_RANDOM:
+      // from the session's own Rng
+      cell = aiRandomMove(s.board, s.rng);
+      return true;
+    case AI_MCTS:
+      // the tree of the last move is kept when it still fits
+      if(!mctsRunning())
+        mctsBegin(s.board);
+      if(!mctsStep(budgetUs))
+        return false;
+      cell = mctsMove();
+      return true;
+#ifndef TTT_RUNTIME_SEARCH
+    case AI_SMART:
+      // perfect play is precomputed, see movetable.h
+      cell = aiBestMove(s.board);
+      return true;
+#endif
+    default:
+      return sessionSearch(s.board, aiModeDepth[s.aiMode], budgetUs, cell);
+  }
+}
+
+unsigned long sessionAiNodes(const GameSession &s){
+  switch(s.aiMode){
+    case AI_RANDOM:
+      return 0;
+    case AI_MCTS:
+      return mctsPlayouts();
+#ifndef TTT_RUNTIME_SEARCH
+    case AI_SMART:
+      return 0;
+#endif
+    default:
+      return searchNodes();
+  }
+}
@@ -0,0 +1,71 @@
+#include "hal.h"
+#include "ttable.h"
+
+#ifndef TTT_NO_TT
+
+HAL_THREAD_LOCAL TTEntry tt[TT_ENTRIES];
+
+static uint16_t ttIndex(const Board &canon){
+  return (uint16_t)(canon.x * 31 + canon.o * 1021) & (TT_ENTRIES - 1);
+}
+static uint16_t ttKey(const Board &canon){
+  return canon.x | (canon.o << 9);
+}
+
+void ttClear(){
+  for(uint16_t i = 0; i < TT_ENTRIES; i++){
+    tt[i].bound = 0;
+  }
+}
+
+bool ttProbe(const Board &board, int depth, uint8_t &bound, int &value, uint8_t &move){
+  Board canon;
+  uint8_t sym = bbCanonical(board, canon);
+  TTEntry &e = tt[ttIndex(canon)];
+  if(e.bound == 0 || e.key != ttKey(canon) || e.keyHi != (canon.o >> 7)){
+    return false;
+  }
+  bound = e.bound;
+  // back from "distance from this node" to "distance from the root"
+  value = e.value;
+  if(value > 0){
+    value -= depth;
+  }else if(value < 0){
+    value += depth;
+  }
+  move = BB_CELLS;
+  if(e.move < BB_CELLS){
+    move = __builtin_ctz(bbUntransform(bbBit(e.move), sym));
+  }
+  return true;
+}
+
+void ttStore(const Board &board, int depth, uint8_t bound, int value, uint8_t move){
+  Board canon;
+  uint8_t sym = bbCanonical(board, canon);
+  TTEntry &e = tt[ttIndex(canon)];
+  // scores count plies from the root, store them counted from this node
+  if(value > 0){
+    value += depth;
+  }else if(value < 0){
+    value -= depth;
+  }
+  e.key = ttKey(canon);
+  e.keyHi = canon.o >> 7;
+  e.bound = bound;
+  e.move = BB_CELLS;
+  if(move < BB_CELLS){
+    e.move = __builtin_ctz(bbTransform(bbBit(move), sym));
+  }
+  e.value = value;
+}
+
+#else
+
+void ttClear(){}
+bool ttProbe(const Board &, int, uint8_t &, int &, uint8_t &){
+  return false;
+}
+void ttStore(const Board &, int, uint8_t, int, uint8_t){}
+
+#endif
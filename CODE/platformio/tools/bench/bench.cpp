@@ -0,0 +1,568 @@
+/*
+  *@bench overview
+  *           host benchmark, run it before a search or rendering change goes
+  *           on a board and compare against the last run
+  *                 |-> golden       node counts of search.h from a cleared
+  *                                  transposition table, perft style, for
+  *                                  the empty board, every opening and a few
+  *                                  tricky midgames, any difference fails
+  *                 |-> speed        search nodes/s and ns per position over
+  *                                  every reachable position, ai move, MCTS
+  *                                  move and displayShow() frame times, best
+  *                                  of -r rounds
+  *                 |-> latency      the real firmware (main.cpp) replays
+  *                                  button traces through the screens, the
+  *                                  time of every scheduler pass that ran a
+  *                                  task is kept, mean / p99 / max, best
+  *                                  of -r rounds as well
+  *           traces are text, one "ms buttons" line per change of the held
+  *           buttons, buttons from u r d l s or - for none, # comments
+  *           results go to a flat JSON object (-o), -b compares them with a
+  *           saved one and fails on anything more than -p percent worse or
+  *           any node count that went up, the max pass times are only shown
+  *           the clock is simulated but runs at wall speed while firmware
+  *           code runs, so search slices end on time and idle time is free
+  *
+  *           pio run -e bench && .pio/build/bench/program [-o out.json]
+  *                 [-b baseline.json] [-p percent] [-r rounds] [-i trace]...
+  *                 [-u]
+  *
+*/
+
+#include "hal.h"
+#include "hardware.h"
+#include "game.h"
+#include "search.h"
+#include "ttable.h"
+#include "ai.h"
+#include "mcts.h"
+#include "display.h"
+#include "animation.h"
+#include "scheduler.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <map>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+void setup();
+
+const uint32_t IDLE_STEP_US = 100;    // simulated time of a pass that ran nothing
+const uint32_t TRACE_TAIL_MS = 3000;  // keep running after the last event
+const int MCTS_MOVES = 20;
+const int RENDER_FRAMES = 100000;
+const uint32_t BENCH_SEED = 1;
+const double LATENCY_SLACK_US = 1;    // latency changes smaller than this pass
+
+// golden ---------------------------------------------------------------------
+struct Golden {
+  const char *name;
+  uint16_t x;
+  uint16_t o;
+  uint8_t depth;
+  unsigned long nodes;
+  int8_t move;
+  int8_t score;
+};
+
+// counts of the default build (transposition table of 1024 bytes), update
+// them with -u when a change to the search means to change them
+const Golden GOLDEN[] = {
+  {"empty", 0000, 0000, SEARCH_FULL, 427, 4, 0},
+  {"empty easy", 0000, 0000, 2, 26, 4, 0},
+  {"empty medium", 0000, 0000, 4, 206, 4, 0},
+  {"open 0", 0001, 0000, SEARCH_FULL, 310, 4, 0},
+  {"open 1", 0002, 0000, SEARCH_FULL, 317, 4, 0},
+  {"open 2", 0004, 0000, SEARCH_FULL, 284, 4, 0},
+  {"open 3", 0010, 0000, SEARCH_FULL, 308, 4, 0},
+  {"open 4", 0020, 0000, SEARCH_FULL, 248, 0, 0},
+  {"open 5", 0040, 0000, SEARCH_FULL, 379, 4, 0},
+  {"open 6", 0100, 0000, SEARCH_FULL, 303, 4, 0},
+  {"open 7", 0200, 0000, SEARCH_FULL, 373, 4, 0},
+  {"open 8", 0400, 0000, SEARCH_FULL, 326, 4, 0},
+  {"opposite corners", 0401, 0020, SEARCH_FULL, 105, 1, 0},
+  {"corner edge centre", 0021, 0002, SEARCH_FULL, 74, 8, 6},
+  {"corner edge", 0001, 0002, SEARCH_FULL, 156, 4, 5},
+  {"centre corner", 0420, 0001, SEARCH_FULL, 84, 2, 0},
+  {"edge corner", 0002, 0001, SEARCH_FULL, 310, 4, 0},
+  {"late", 0205, 0022, SEARCH_FULL, 28, 6, 0},
+  {"late medium", 0205, 0022, 4, 45, 6, 0},
+};
+const int NUM_GOLDEN = sizeof(GOLDEN) / sizeof(GOLDEN[0]);
+
+#if defined(TTT_NO_TT) || TT_SRAM_BUDGET != 1024
+const bool GOLDEN_BUILD = false;
+#else
+const bool GOLDEN_BUILD = true;
+#endif
+
+// positions the golden table is made of, -u prints their counts
+struct Position {
+  std::string name;
+  uint16_t x;
+  uint16_t o;
+  uint8_t depth;
+};
+
+static std::vector<Position> goldenPositions(){
+  std::vector<Position> p;
+  p.push_back({"empty", 0, 0, SEARCH_FULL});
+  p.push_back({"empty easy", 0, 0, 2});
+  p.push_back({"empty medium", 0, 0, 4});
+  for(int cell = 0; cell < BB_CELLS; cell++)
+    p.push_back({"open " + std::to_string(cell), bbBit(cell), 0, SEARCH_FULL});
+  // O has to answer on an edge, a corner loses to the fork
+  p.push_back({"opposite corners", 0401, 0020, SEARCH_FULL});
+  // X takes the centre after O's edge reply, O must block 8
+  p.push_back({"corner edge centre", 0021, 0002, SEARCH_FULL});
+  // O's edge reply to a corner loses, X to find the fork
+  p.push_back({"corner edge", 0001, 0002, SEARCH_FULL});
+  // centre and corner against a corner, O to block and not fall for 6/2
+  p.push_back({"centre corner", 0420, 0001, SEARCH_FULL});
+  // edge opening, X to move after O's corner
+  p.push_back({"edge corner", 0002, 0001, SEARCH_FULL});
+  // late, one move from a forced draw
+  p.push_back({"late", 0205, 0022, SEARCH_FULL});
+  p.push_back({"late medium", 0205, 0022, 4});
+  return p;
+}
+
+struct SearchResult {
+  unsigned long nodes;
+  int move;
+  int score;
+};
+
+static SearchResult runSearch(const Board &b, uint8_t depth){
+  ttClear();
+  searchBegin(b, depth);
+  while(!searchStep(UINT32_MAX)){
+  }
+  return {searchNodes(), searchMove(), searchScore()};
+}
+
+// results --------------------------------------------------------------------
+std::map<std::string, double> results;
+
+static std::string key(const std::string &name){
+  std::string k = name;
+  std::replace(k.begin(), k.end(), ' ', '_');
+  return k;
+}
+
+static double now(){
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// records the counts, update prints them as a table, check compares them
+static int checkGolden(bool update, bool check){
+  std::vector<Position> positions = goldenPositions();
+  int differences = 0;
+  if(update)
+    printf("const Golden GOLDEN[] = {\n");
+  for(const Position &p : positions){
+    SearchResult r = runSearch(Board{p.x, p.o}, p.depth);
+    results["golden." + key(p.name) + ".nodes"] = r.nodes;
+    if(update){
+      printf("  {\"%s\", 0%03o, 0%03o, %s, %lu, %d, %d},\n", p.name.c_str(), p.x, p.o,
+             p.depth == SEARCH_FULL ? "SEARCH_FULL" : std::to_string(p.depth).c_str(), r.nodes, r.move, r.score);
+      continue;
+    }
+    if(!check)
+      continue;
+    const Golden *g = NULL;
+    for(int i = 0; i < NUM_GOLDEN; i++){
+      if(p.name == GOLDEN[i].name)
+        g = &GOLDEN[i];
+    }
+    if(!g){
+      printf("  golden %-20s not in the table, run with -u\n", p.name.c_str());
+      differences++;
+    }else if(g->x != p.x || g->o != p.o || g->depth != p.depth || g->nodes != r.nodes
+             || g->move != r.move || g->score != r.score){
+      printf("  golden %-20s nodes %lu move %d score %d, table %lu %d %d\n", p.name.c_str(),
+             r.nodes, r.move, r.score, g->nodes, g->move, g->score);
+      differences++;
+    }
+  }
+  if(update)
+    printf("};\n");
+  return differences;
+}
+
+// speed ----------------------------------------------------------------------
+static void collect(const Board &b, std::vector<bool> &seen, std::vector<Board> &out){
+  uint16_t idx = 0, pow3 = 1;
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++, pow3 *= 3){
+    if(b.x & bbBit(cell))
+      idx += pow3;
+    else if(b.o & bbBit(cell))
+      idx += 2*pow3;
+  }
+  if(seen[idx])
+    return;
+  seen[idx] = true;
+  if(bbWinner(b) != -1 || !bbEmpty(b))
+    return;
+  out.push_back(b);
+  uint16_t empty = bbEmpty(b);
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    if(empty & bbBit(cell)){
+      Board child = b;
+      bbPlace(child, cell, bbXTurn(b));
+      collect(child, seen, out);
+    }
+  }
+}
+
+static void benchSpeed(int rounds){
+  std::vector<bool> seen(19683);
+  std::vector<Board> positions;
+  collect(Board{0, 0}, seen, positions);
+
+  double best = 0;
+  unsigned long nodes = 0;
+  for(int round = 0; round < rounds; round++){
+    nodes = 0;
+    double start = now();
+    for(const Board &b : positions)
+      nodes += runSearch(b, SEARCH_FULL).nodes;
+    double seconds = now() - start;
+    if(round == 0 || seconds < best)
+      best = seconds;
+  }
+  results["search.positions"] = positions.size();
+  results["search.nodes"] = nodes;
+  results["search.nodes_per_sec"] = nodes / best;
+  results["search.ns_per_position"] = best * 1e9 / positions.size();
+
+  best = 0;
+  volatile int sink = 0;
+  for(int round = 0; round < rounds; round++){
+    double start = now();
+    for(const Board &b : positions)
+      sink += aiBestMove(b);
+    double seconds = now() - start;
+    if(round == 0 || seconds < best)
+      best = seconds;
+  }
+  results["ai.ns_per_position"] = best * 1e9 / positions.size();
+
+  mctsSeed(BENCH_SEED);
+  double start = now();
+  for(int i = 0; i < MCTS_MOVES; i++){
+    // a fresh tree every move, nothing to reuse
+    Board b = {bbBit(i % BB_CELLS), 0};
+    mctsBegin(b);
+    while(!mctsStep(UINT32_MAX)){
+    }
+    sink += mctsMove();
+  }
+  results["mcts.us_per_move"] = (now() - start) * 1e6 / MCTS_MOVES;
+
+  Rng rng;
+  rngSeed(rng, BENCH_SEED);
+  std::vector<std::array<LedColor, LEDS>> frames(64);
+  for(auto &f : frames){
+    for(LedColor &c : f)
+      c = LedColor{(uint8_t)rngBelow(rng, LED_MAX + 1), (uint8_t)rngBelow(rng, LED_MAX + 1),
+                   (uint8_t)rngBelow(rng, LED_MAX + 1), (uint8_t)rngBelow(rng, 2)};
+  }
+  best = 0;
+  for(int round = 0; round < rounds; round++){
+    start = now();
+    for(int i = 0; i < RENDER_FRAMES; i++)
+      displayShow((const LedColor (*)[COL])frames[i % frames.size()].data());
+    double seconds = now() - start;
+    if(round == 0 || seconds < best)
+      best = seconds;
+  }
+  results["render.ns_per_frame"] = best * 1e9 / RENDER_FRAMES;
+}
+
+// latency --------------------------------------------------------------------
+struct TraceEvent {
+  uint32_t ms;
+  uint8_t buttons;  // bit b == button b held
+};
+struct Trace {
+  std::string name;
+  std::vector<TraceEvent> events;
+};
+
+// hand-written button traces, see the overview for the format
+const char *const BUILTIN_TRACES[][2] = {
+  {"smart game",
+   "# X against the smart AI, select wherever the cursor is\n"
+   "200 s\n300 -\n"
+   "1000 s\n1100 -\n2000 s\n2100 -\n3000 s\n3100 -\n4000 s\n4100 -\n5000 s\n5100 -\n"
+   "7000 s\n7100 -\n"},
+  {"mcts as X",
+   "# play O, up+down twice for MCTS, which moves first\n"
+   "200 r\n300 -\n"
+   "600 ud\n700 -\n1000 ud\n1100 -\n"
+   "1500 s\n1600 -\n"
+   "3000 s\n3100 -\n4500 s\n4600 -\n6000 s\n6100 -\n7500 s\n7600 -\n"
+   "9500 s\n9600 -\n"},
+  {"medium",
+   "# up+down four times for medium, X, walk the cursor around\n"
+   "200 ud\n300 -\n500 ud\n600 -\n800 ud\n900 -\n1100 ud\n1200 -\n"
+   "1500 s\n1600 -\n"
+   "2000 d\n2100 -\n2300 r\n2400 -\n2600 s\n2700 -\n"
+   "3500 r\n3600 -\n3800 s\n3900 -\n4800 s\n4900 -\n5800 s\n5900 -\n6800 s\n6900 -\n"
+   "8500 s\n8600 -\n"},
+  {"party",
+   "# into a game, left+right for the party screen, select out\n"
+   "200 s\n300 -\n1000 lr\n1100 -\n4000 s\n4100 -\n"},
+  {"attract",
+   "# idle start screen until attract mode, any button wakes it\n"
+   "32000 u\n32100 -\n"},
+};
+
+static bool parseTrace(const std::string &name, const char *text, Trace &t){
+  t.name = name;
+  t.events.clear();
+  const char *c = text;
+  while(*c){
+    const char *end = strchr(c, '\n');
+    std::string line(c, end ? end - c : strlen(c));
+    c = end ? end + 1 : c + line.size();
+    size_t hash = line.find('#');
+    if(hash != std::string::npos)
+      line.erase(hash);
+    char buttons[16];
+    unsigned long ms;
+    int fields = sscanf(line.c_str(), "%lu %15s", &ms, buttons);
+    if(fields <= 0)
+      continue;
+    if(fields != 2)
+      return false;
+    TraceEvent e = {(uint32_t)ms, 0};
+    for(const char *b = buttons; *b; b++){
+      const char *at = strchr("urdls", *b);
+      if(at)
+        e.buttons |= 1 << (at - "urdls");
+      else if(*b != '-')
+        return false;
+    }
+    t.events.push_back(e);
+  }
+  return !t.events.empty();
+}
+
+static void setButtons(uint8_t buttons){
+  for(int b = 0; b < NUM_BUTTONS; b++)
+    halSetInput(hwButtonPin(b), (buttons & (1 << b)) ? LOW : HIGH);
+}
+
+// keeps the smaller of a result over rounds, the rest is host noise
+static void keepBest(const std::string &k, double value, int round){
+  if(round == 0 || value < results[k])
+    results[k] = value;
+}
+
+static void replay(const Trace &t, int round){
+  // every trace starts from the start screen with the same dice
+  setButtons(0);
+  halAdvance(50000);
+  gameSetup();
+  rngSeed(game.session.rng, BENCH_SEED);
+  mctsSeed(BENCH_SEED);
+  animSeed(BENCH_SEED);
+
+  std::vector<double> passes;
+  uint32_t start = millis();
+  uint32_t end = t.events.back().ms + TRACE_TAIL_MS;
+  size_t next = 0;
+  while(millis() - start < end){
+    while(next < t.events.size() && millis() - start >= t.events[next].ms)
+      setButtons(t.events[next++].buttons);
+    double begin = now();
+    uint8_t ran = schedRun();
+    double took = now() - begin;
+    if(ran){
+      passes.push_back(took * 1e6);
+      halRunTimers();
+    }else{
+      halAdvance(IDLE_STEP_US);
+    }
+  }
+
+  std::sort(passes.begin(), passes.end());
+  double sum = 0;
+  for(double us : passes)
+    sum += us;
+  std::string k = "trace." + key(t.name);
+  results[k + ".passes"] = passes.size();
+  keepBest(k + ".mean_us", passes.empty() ? 0 : sum / passes.size(), round);
+  keepBest(k + ".p99_us", passes.empty() ? 0 : passes[passes.size() * 99 / 100], round);
+  keepBest(k + ".max_us", passes.empty() ? 0 : passes.back(), round);
+}
+
+// output ---------------------------------------------------------------------
+static bool writeJson(const char *path){
+  FILE *f = fopen(path, "w");
+  if(!f)
+    return false;
+  fprintf(f, "{\n");
+  size_t i = 0;
+  for(const auto &r : results)
+    fprintf(f, "  \"%s\": %.6g%s\n", r.first.c_str(), r.second, ++i < results.size() ? "," : "");
+  fprintf(f, "}\n");
+  return fclose(f) == 0;
+}
+
+// reads what writeJson() writes, one "key": number per line
+static bool readJson(const char *path, std::map<std::string, double> &out){
+  FILE *f = fopen(path, "r");
+  if(!f)
+    return false;
+  char line[256];
+  while(fgets(line, sizeof(line), f)){
+    char name[128];
+    double value;
+    if(sscanf(line, " \"%127[^\"]\": %lf", name, &value) == 2)
+      out[name] = value;
+  }
+  fclose(f);
+  return true;
+}
+
+static bool endsWith(const std::string &s, const char *suffix){
+  size_t n = strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+// prints every result against the baseline, returns the regressions
+static int compare(const std::map<std::string, double> &base, double percent){
+  int regressions = 0;
+  printf("%-36s %14s %14s %9s\n", "result", "baseline", "now", "change");
+  for(const auto &r : results){
+    auto b = base.find(r.first);
+    if(b == base.end()){
+      printf("%-36s %14s %14.6g %9s\n", r.first.c_str(), "-", r.second, "new");
+      continue;
+    }
+    double change = b->second ? 100 * (r.second - b->second) / b->second : 0;
+    // node counts are exact, speeds are better higher, times better lower
+    bool exact = endsWith(r.first, ".nodes");
+    bool higher = endsWith(r.first, "_per_sec");
+    // one pass is too noisy to fail on, and a pass is well under 1us on a
+    // PC so its times need a real difference as well as a percentage
+    bool info = endsWith(r.first, ".passes") || endsWith(r.first, ".positions")
+                || endsWith(r.first, ".max_us");
+    bool small = endsWith(r.first, "_us") && fabs(r.second - b->second) < LATENCY_SLACK_US;
+    const char *verdict = "";
+    if(!info && exact && r.second > b->second){
+      verdict = "  WORSE";
+      regressions++;
+    }else if(!info && !exact && !small && (higher ? -change : change) > percent){
+      verdict = "  WORSE";
+      regressions++;
+    }
+    printf("%-36s %14.6g %14.6g %+8.1f%%%s\n", r.first.c_str(), b->second, r.second, change, verdict);
+  }
+  return regressions;
+}
+
+static void usage(){
+  fprintf(stderr, "usage: bench [-o out.json] [-b baseline.json] [-p percent] [-r rounds] [-i trace]... [-u]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  const char *out = "bench.json";
+  const char *baseline = NULL;
+  double percent = 10;
+  int rounds = 5;
+  bool update = false;
+  std::vector<const char *> traceFiles;
+  for(int i = 1; i < argc; i++){
+    if(!strcmp(argv[i], "-u")){
+      update = true;
+      continue;
+    }
+    if(i + 1 >= argc)
+      usage();
+    if(!strcmp(argv[i], "-o"))
+      out = argv[++i];
+    else if(!strcmp(argv[i], "-b"))
+      baseline = argv[++i];
+    else if(!strcmp(argv[i], "-p"))
+      percent = atof(argv[++i]);
+    else if(!strcmp(argv[i], "-r"))
+      rounds = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-i"))
+      traceFiles.push_back(argv[++i]);
+    else
+      usage();
+  }
+  if(rounds < 1)
+    rounds = 1;
+
+  if(update){
+    checkGolden(true, false);
+    return 0;
+  }
+
+  std::vector<Trace> traces;
+  for(const auto &b : BUILTIN_TRACES){
+    Trace t;
+    parseTrace(b[0], b[1], t);
+    traces.push_back(t);
+  }
+  for(const char *path : traceFiles){
+    FILE *f = fopen(path, "r");
+    std::string text;
+    char buf[256];
+    while(f && fgets(buf, sizeof(buf), f))
+      text += buf;
+    if(f)
+      fclose(f);
+    Trace t;
+    if(!f || !parseTrace(path, text.c_str(), t)){
+      fprintf(stderr, "bench: can't read trace %s\n", path);
+      return 2;
+    }
+    traces.push_back(t);
+  }
+
+  if(!GOLDEN_BUILD)
+    printf("golden counts are for the default transposition table, not checked\n");
+  int failures = checkGolden(false, GOLDEN_BUILD);
+  benchSpeed(rounds);
+
+  // the firmware itself, its log frames would only clutter the output
+  halSerialQuiet(true);
+  halUseSimClock(true, true);
+  setup();
+  for(int round = 0; round < rounds; round++){
+    for(const Trace &t : traces)
+      replay(t, round);
+  }
+  halSerialQuiet(false);
+
+  if(!writeJson(out)){
+    fprintf(stderr, "bench: can't write %s\n", out);
+    return 2;
+  }
+  if(baseline){
+    std::map<std::string, double> base;
+    if(!readJson(baseline, base)){
+      fprintf(stderr, "bench: can't read %s\n", baseline);
+      return 2;
+    }
+    failures += compare(base, percent);
+  }else{
+    for(const auto &r : results)
+      printf("%-36s %14.6g\n", r.first.c_str(), r.second);
+  }
+  printf("%d failures, results in %s\n", failures, out);
+  return failures ? 1 : 0;
+}
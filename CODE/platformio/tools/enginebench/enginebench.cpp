@@ -0,0 +1,268 @@
+/*
+  *@enginebench overview
+  *           host tool, checks the generic engine (engine.h) against the
+  *           hand written tic-tac-toe search (search.h) and times both
+  *                 |-> tic-tac-toe   every reachable position, both searches
+  *                                   from a cleared transposition table, must
+  *                                   give the move table's score and a move
+  *                                   that keeps it, the engine may visit at
+  *                                   most MAX_NODE_RATIO times the nodes
+  *                                   (search.h adds PVS and killers to the
+  *                                   same move order)
+  *                 |-> hexapawn      every reachable position against a plain
+  *                                   recursive negamax, black must win
+  *           exit code 1 on any difference
+  *
+  *           pio run -e enginebench && .pio/build/enginebench/program [-r rounds]
+  *
+*/
+
+#include "hal.h"
+#include "search.h"
+#include "engine.h"
+#include "tictactoe.h"
+#include "hexapawn.h"
+#include "movetable.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+const size_t MAX_REPORTED = 20;
+// engine / hand written nodes, 1.03 with the transposition table and 1.21
+// without (TTT_NO_TT)
+const double MAX_NODE_RATIO = 1.25;
+
+struct Result {
+  int move;
+  int score;
+  unsigned long nodes;
+};
+
+static double now(){
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// tic-tac-toe ---------------------------------------------------------------
+std::vector<Board> positions;
+
+static void collectPositions(const Board &b, std::vector<bool> &seen){
+  uint16_t idx = 0, pow3 = 1;
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++, pow3 *= 3){
+    if(b.x & bbBit(cell))
+      idx += pow3;
+    else if(b.o & bbBit(cell))
+      idx += 2*pow3;
+  }
+  if(seen[idx])
+    return;
+  seen[idx] = true;
+  if(bbHasLine(b.x) || bbHasLine(b.o) || !bbEmpty(b))
+    return;
+  positions.push_back(b);
+  uint16_t empty = bbEmpty(b);
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    if(empty & bbBit(cell)){
+      Board child = b;
+      bbPlace(child, cell, bbXTurn(b));
+      collectPositions(child, seen);
+    }
+  }
+}
+
+// exact score of b on the utility() scale, from the move table
+static int tableScore(const Board &b){
+  int winner = bbWinner(b);
+  if(winner != -1)
+    return winner ? 10 : -10;
+  if(!bbEmpty(b))
+    return 0;
+  uint8_t e = mtLookup(b);
+  return bbXTurn(b) ? mtScore(e) : -mtScore(e);
+}
+// one ply further from the root, a win or loss counts one less
+static int tableBack(int score){
+  return score > 0 ? score - 1 : score < 0 ? score + 1 : 0;
+}
+static bool perfect(const Board &b, const Result &r){
+  int best = tableScore(b);
+  if(r.score != best || r.move < 0 || r.move >= BB_CELLS || !(bbEmpty(b) & bbBit(r.move)))
+    return false;
+  Board child = b;
+  bbPlace(child, r.move, bbXTurn(b));
+  return tableBack(tableScore(child)) == best;
+}
+
+static Result handWritten(const Board &b){
+  ttClear();
+  searchBegin(b);
+  while(!searchStep(UINT32_MAX)){
+  }
+  return {searchMove(), searchScore(), searchNodes()};
+}
+
+Engine<TicTacToe> tttEngine;
+
+static Result generic(const Board &b){
+  ttClear();
+  SearchState s;
+  ssInit(s, b);
+  tttEngine.begin(s);
+  while(!tttEngine.step(UINT32_MAX)){
+  }
+  TicTacToe::Move m = tttEngine.move();
+  return {m == TicTacToe::NO_MOVE ? -1 : m, tttEngine.score(), tttEngine.nodes()};
+}
+
+static int benchTicTacToe(int rounds){
+  std::vector<bool> seen(19683);
+  collectPositions(Board{0, 0}, seen);
+
+  int differences = 0;
+  unsigned long nodes[2] = {0, 0};
+  double seconds[2] = {0, 0};
+  for(int round = 0; round < rounds; round++){
+    std::vector<Result> results[2];
+    for(int which = 0; which < 2; which++){
+      double start = now();
+      for(const Board &b : positions)
+        results[which].push_back(which ? generic(b) : handWritten(b));
+      seconds[which] += now() - start;
+    }
+    for(size_t i = 0; i < positions.size(); i++){
+      const Result &a = results[0][i], &g = results[1][i];
+      nodes[0] += a.nodes;
+      nodes[1] += g.nodes;
+      if(perfect(positions[i], a) && perfect(positions[i], g))
+        continue;
+      if(differences++ < (int)MAX_REPORTED){
+        printf("  x %03o o %03o: search %d/%d/%lu, engine %d/%d/%lu (move/score/nodes)\n",
+               positions[i].x, positions[i].o, a.move, a.score, a.nodes, g.move, g.score, g.nodes);
+      }
+    }
+  }
+
+  printf("tic-tac-toe, %zu positions x %d rounds\n", positions.size(), rounds);
+  printf("%-14s %12s %10s %12s\n", "search", "nodes", "seconds", "nodes/s");
+  const char *NAMES[2] = {"hand written", "Engine<>"};
+  for(int which = 0; which < 2; which++){
+    printf("%-14s %12lu %10.3f %12.0f\n", NAMES[which], nodes[which], seconds[which],
+           seconds[which] > 0 ? nodes[which] / seconds[which] : 0.0);
+  }
+  double ratio = nodes[0] ? (double)nodes[1] / nodes[0] : 0.0;
+  printf("engine/hand written nodes %.2f, time %.2f, %d imperfect\n",
+         ratio, seconds[0] > 0 ? seconds[1] / seconds[0] : 0.0, differences);
+  if(ratio > MAX_NODE_RATIO){
+    printf("  engine nodes over %.2fx the hand written search's\n", MAX_NODE_RATIO);
+    differences++;
+  }
+  printf("\n");
+  return differences;
+}
+
+// hexapawn ------------------------------------------------------------------
+// plain recursive negamax, shares nothing with the engine but the rules
+static int refHexapawn(HexapawnState &s, int depth){
+  if(Hexapawn::terminal(s)){
+    int value = Hexapawn::evaluate(s);
+    return value > 0 ? value - depth : value < 0 ? value + depth : 0;
+  }
+  bool white = Hexapawn::maximising(s);
+  int best = white ? -ENGINE_INF : ENGINE_INF;
+  uint8_t cursor = 0;
+  Hexapawn::Move m;
+  while(Hexapawn::nextMove(s, cursor, m)){
+    Hexapawn::make(s, m);
+    int value = refHexapawn(s, depth + 1);
+    Hexapawn::unmake(s, m);
+    if(white ? value > best : value < best)
+      best = value;
+  }
+  return best;
+}
+
+Engine<Hexapawn> hexEngine;
+
+static void checkHexapawn(HexapawnState &s, unsigned long &positionCount, unsigned long &nodes, int &differences){
+  if(Hexapawn::terminal(s))
+    return;
+  positionCount++;
+  hexEngine.begin(s);
+  while(!hexEngine.step(UINT32_MAX)){
+  }
+  nodes += hexEngine.nodes();
+  HexapawnState copy = s;
+  int expected = refHexapawn(copy, 0);
+  int got = hexEngine.score();
+  bool legal = false;
+  int moveScore = 0;
+  uint8_t cursor = 0;
+  Hexapawn::Move m;
+  while(Hexapawn::nextMove(s, cursor, m)){
+    if(m != hexEngine.move())
+      continue;
+    legal = true;
+    Hexapawn::make(s, m);
+    moveScore = refHexapawn(s, 1);
+    Hexapawn::unmake(s, m);
+  }
+  if(!legal || got != expected || moveScore != expected){
+    if(differences++ < (int)MAX_REPORTED){
+      printf("  white %03o black %03o %s: engine %d/%d, negamax %d\n",
+             s.white, s.black, s.whiteTurn ? "white" : "black", hexEngine.move(), got, expected);
+    }
+  }
+  cursor = 0;
+  while(Hexapawn::nextMove(s, cursor, m)){
+    Hexapawn::make(s, m);
+    checkHexapawn(s, positionCount, nodes, differences);
+    Hexapawn::unmake(s, m);
+  }
+}
+
+static int benchHexapawn(){
+  HexapawnState s = Hexapawn::start();
+  unsigned long positionCount = 0, nodes = 0;
+  int differences = 0;
+  double start = now();
+  checkHexapawn(s, positionCount, nodes, differences);
+  double seconds = now() - start;
+
+  hexEngine.begin(Hexapawn::start());
+  while(!hexEngine.step(UINT32_MAX)){
+  }
+  int score = hexEngine.score();
+  printf("hexapawn, %lu positions (every line), %lu engine nodes, %.3fs\n", positionCount, nodes, seconds);
+  printf("start: %s wins in %d plies, %d differences\n",
+         score > 0 ? "white" : "black", Hexapawn::WIN - abs(score), differences);
+  if(score >= 0){
+    printf("  black should win hexapawn\n");
+    differences++;
+  }
+  return differences;
+}
+
+static void usage(){
+  fprintf(stderr, "usage: enginebench [-r rounds]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  int rounds = 3;
+  for(int i = 1; i < argc; i++){
+    if(i + 1 >= argc)
+      usage();
+    if(!strcmp(argv[i], "-r"))
+      rounds = atoi(argv[++i]);
+    else
+      usage();
+  }
+  if(rounds < 1)
+    rounds = 1;
+
+  int differences = benchTicTacToe(rounds);
+  differences += benchHexapawn();
+  return differences ? 1 : 0;
+}
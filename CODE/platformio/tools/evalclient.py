@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""
+Host side of the Serial protocol in include/protocol.h.
+
+Sends every legal 3x3 position to the board in PROTO_EVAL batches and
+checks each reply against a plain minimax, then prints positions/s.
+
+    python3 tools/evalclient.py /dev/ttyACM0
+
+needs pyserial (pip install pyserial)
+"""
+
+import sys
+import time
+from functools import lru_cache
+
+import serial
+
+BAUD = 500000
+MAX_BATCH = 64
+NO_MOVE = 0xFF
+EVAL, PROFILE = 0x01, 0x02
+EVAL_REPLY, PROFILE_REPLY, LOG, NAK = 0x81, 0x82, 0x83, 0xFF
+LINES = (0o007, 0o070, 0o700, 0o111, 0o222, 0o444, 0o421, 0o124)
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1) & 0xFFFF
+    return crc
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_at, code = 0, 1
+    for b in data:
+        if b == 0:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+        else:
+            out.append(b)
+            code += 1
+    out[code_at] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def frame(msg_type, seq, body=b""):
+    payload = bytes([msg_type, seq]) + body
+    crc = crc16(payload)
+    return b"\0" + cobs_encode(payload + bytes([crc & 0xFF, crc >> 8])) + b"\0"
+
+
+class Link:
+    def __init__(self, port):
+        self.port = serial.Serial(port, BAUD, timeout=2)
+        self.buf = bytearray()
+
+    def send(self, msg_type, seq, body=b""):
+        self.port.write(frame(msg_type, seq, body))
+
+    def receive(self):
+        # next good frame as (type, seq, body), log frames are printed
+        while True:
+            while b"\0" not in self.buf:
+                chunk = self.port.read(max(1, self.port.in_waiting))
+                if not chunk:
+                    raise TimeoutError("no reply from the board")
+                self.buf += chunk
+            raw, _, self.buf = self.buf.partition(b"\0")
+            payload = cobs_decode(bytes(raw)) if raw else None
+            if not payload or len(payload) < 4:
+                continue
+            if crc16(payload[:-2]) != payload[-2] | payload[-1] << 8:
+                continue
+            msg_type, seq, body = payload[0], payload[1], payload[2:-2]
+            if msg_type == LOG:
+                print("log:", body.decode(errors="replace"))
+                continue
+            return msg_type, seq, body
+
+
+def has_line(mask):
+    return any(mask & line == line for line in LINES)
+
+
+def legal(x, o):
+    nx, no = bin(x).count("1"), bin(o).count("1")
+    if x & o or nx not in (no, no + 1):
+        return False
+    if has_line(x) and nx != no + 1:
+        return False
+    if has_line(o) and nx != no:
+        return False
+    return True
+
+
+@lru_cache(maxsize=None)
+def solve(x, o):
+    # value for the side to move, +1 win, 0 draw, -1 loss
+    if has_line(x) or has_line(o):
+        return -1
+    empty = ~(x | o) & 0o777
+    if not empty:
+        return 0
+    x_turn = bin(x).count("1") <= bin(o).count("1")
+    return max(-solve(x | 1 << c, o) if x_turn else -solve(x, o | 1 << c)
+               for c in range(9) if empty >> c & 1)
+
+
+def check(x, o, move, score):
+    if has_line(x) or has_line(o) or not ~(x | o) & 0o777:
+        want = 10 if has_line(x) else -10 if has_line(o) else 0
+        return move == NO_MOVE and score == want
+    if move > 8 or (x | o) >> move & 1:
+        return False
+    x_turn = bin(x).count("1") <= bin(o).count("1")
+    value = solve(x, o)
+    after = -solve(x | 1 << move, o) if x_turn else -solve(x, o | 1 << move)
+    sign = (score > 0) - (score < 0)
+    return after == value and (sign if x_turn else -sign) == value
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+    link = Link(sys.argv[1])
+    time.sleep(2)  # the MEGA resets when the port opens
+    link.port.reset_input_buffer()
+
+    positions = [(x, o) for x in range(512) for o in range(512) if legal(x, o)]
+    wrong = 0
+    start = time.time()
+    for seq, first in enumerate(range(0, len(positions), MAX_BATCH)):
+        seq &= 0xFF
+        batch = positions[first:first + MAX_BATCH]
+        body = bytearray([len(batch)])
+        for x, o in batch:
+            body += (x | o << 9).to_bytes(3, "little")
+        link.send(EVAL, seq, bytes(body))
+        answered = 0
+        while answered < len(batch):
+            msg_type, reply_seq, reply = link.receive()
+            if msg_type == NAK:
+                sys.exit("NAK seq %d code %d" % (reply_seq, reply[0]))
+            if msg_type != EVAL_REPLY or reply_seq != seq:
+                continue
+            for k in range(reply[1]):
+                x, o = batch[reply[0] + k]
+                move, score = reply[2 + 2*k], int.from_bytes(reply[3 + 2*k:4 + 2*k], "little", signed=True)
+                if not check(x, o, move, score):
+                    wrong += 1
+                    print("wrong x=%03o o=%03o move %d score %d" % (x, o, move, score))
+            answered += reply[1]
+    elapsed = time.time() - start
+    print("%d positions, %d wrong, %.0f positions/s" % (len(positions), wrong, len(positions) / elapsed))
+    sys.exit(1 if wrong else 0)
+
+
+if __name__ == "__main__":
+    main()
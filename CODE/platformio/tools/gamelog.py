@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""
+Reads the game log a unit keeps in EEPROM (src/gamelog.cpp) over the
+Serial protocol: lifetime win/draw/loss per AI mode, then the last games.
+
+    python3 tools/gamelog.py /dev/ttyACM0 [games]
+
+needs pyserial (pip install pyserial)
+"""
+
+import struct
+import sys
+import time
+
+from evalclient import LINES, NAK, Link
+
+STATS, GAMES = 0x03, 0x04
+STATS_REPLY, GAMES_REPLY = 0x84, 0x85
+MAX_GAMES = 32
+MODES = ("smart", "random", "mcts", "easy", "medium")
+ROWS = MODES + ("2 player",)
+
+
+def request(link, msg_type, reply_type, body=b""):
+    link.send(msg_type, 0, body)
+    while True:
+        got, _, reply = link.receive()
+        if got == NAK:
+            sys.exit("NAK code %d" % reply[0])
+        if got == reply_type:
+            return reply
+
+
+def decode(record):
+    # see the record layout in include/gamelog.h
+    count = record >> 19 & 0xF
+    code = record & (1 << 19) - 1
+    digits = []
+    for i in reversed(range(count)):
+        digits.append(code % (9 - i))
+        code //= 9 - i
+    free = list(range(9))
+    moves = [free.pop(d) for d in reversed(digits)]
+    meta = record >> 23
+    return moves, meta & 7, bool(meta & 8), bool(meta & 16)
+
+
+def winner(moves):
+    masks = [0, 0]
+    for i, cell in enumerate(moves):
+        masks[i & 1] |= 1 << cell
+    for side, name in ((0, "X"), (1, "O")):
+        if any(masks[side] & line == line for line in LINES):
+            return name
+    return "draw"
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit(__doc__)
+    wanted = int(sys.argv[2]) if len(sys.argv) == 3 else 10
+    link = Link(sys.argv[1])
+    time.sleep(2)  # the MEGA resets when the port opens
+    link.port.reset_input_buffer()
+
+    reply = request(link, STATS, STATS_REPLY)
+    laps, *games = struct.unpack("<%dI" % (len(reply) // 4), reply)
+    print("%-9s %7s %7s %7s" % ("", "win", "draw", "loss"))
+    for row, name in enumerate(ROWS):
+        print("%-9s %7d %7d %7d" % ((name,) + tuple(games[3*row:3*row + 3])))
+    print("ring laps %d (human's side, X in 2 player games)" % laps)
+
+    back = 0
+    while back < wanted:
+        count = min(MAX_GAMES, wanted - back)
+        reply = request(link, GAMES, GAMES_REPLY, struct.pack("<HB", back, count))
+        if not reply[2]:
+            break
+        for i in range(reply[2]):
+            record = int.from_bytes(reply[3 + 4*i:7 + 4*i], "little")
+            moves, mode, two_player, ai_x = decode(record)
+            who = "2 player" if two_player else "%s as %s" % (MODES[mode], "X" if ai_x else "O")
+            print("%4d  %-14s %-5s %s" % (back + i, who, winner(moves), " ".join(map(str, moves))))
+        back += reply[2]
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,493 @@
+/*
+  *@matrixsim overview
+  *           host tool, runs the real display code (display.cpp, drawBoard()
+  *           and allOff() from game.cpp) on the simulated clock and replays
+  *           every port write of the scan interrupt against the BOARDPINS
+  *           wiring, one test pattern at a time
+  *                 |-> refresh      rate and jitter of the scan, timed on the
+  *                                  first column with a lit led
+  *                 |-> duty         on time of every led and colour, shown as
+  *                                  the matrix in the terminal
+  *                 |-> uniformity   dimmest / brightest of the leds that
+  *                                  should look the same
+  *                 |-> ghosting     light on a channel that should be dark,
+  *                                  e.g. a colour written before the old
+  *                                  column's ground is off
+  *                 |-> handoff      all red and all blue frames published at
+  *                                  random times, a refresh that shows some
+  *                                  of both is a torn frame
+  *                 |-> stalls       gaps between interrupts longer than the
+  *                                  longest plane can be, a compare written
+  *                                  behind Timer1's count waits for it to
+  *                                  wrap (262ms)
+  *           port writes inside one interrupt are -w ns apart and every
+  *           interrupt can start up to -l us late, which is how ghosting
+  *           and jitter show up on the simulated clock, display.cpp's
+  *           Timer1 model reads the same clock through halIsrNs(), so a
+  *           late OCR1A write misses its compare like on the board
+  *           -c fails (exit 1) when refresh, uniformity or ghosting is past
+  *           its threshold, a frame tore or the scan stalled, for catching
+  *           flicker without a board
+  *
+  *           pio run -e matrixsim && .pio/build/matrixsim/program [-c] [-q]
+  *                 [-t ms] [-l us] [-w ns] [-s seed] [-r hz] [-u ratio] [-g us]
+  *
+*/
+
+#include "hal.h"
+#include "hardware.h"
+#include "display.h"
+#include "game.h"
+#include "rng.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+const int CHANNELS = LEDS * RGB;   // led (x,y) colour c == (x*COL + y)*RGB + c
+const uint32_t WARMUP_US = 10000;  // a few refreshes before measuring
+const uint32_t HANDOFF_MAX_GAP_US = 3000; // between frames, a little over a refresh
+
+struct Options {
+  unsigned long windowMs = 200;
+  unsigned long latencyUs = 0;
+  unsigned long writeNs = 625;     // ~10 cycles of the ISR's port loop
+  uint32_t seed = 1;
+  double minRefresh = 400;
+  double minUniformity = 0.98;
+  double maxGhost = 1;             // us of ghost light per second
+  bool check = false;
+  bool quiet = false;
+};
+Options opt;
+
+// replay state ---------------------------------------------------------------
+struct Replay {
+  bool recording;
+  double startNs;
+  double lastNs;       // time of the last pin change
+  uint32_t lit;        // channels lit since lastNs
+  uint32_t expected;   // channels the pattern lights
+  double on[CHANNELS]; // ns
+  double ghostNs;
+  unsigned long ghostWindows;
+  uint8_t scanPin;     // ground of the first lit column, 0 == none
+  bool scanHigh;       // and it was high
+  double lastScan;     // ns of the last start of that column
+  // totals at the first and last start of the column in the window, so
+  // duties cover whole refreshes
+  double firstScan;
+  double onFirst[CHANNELS];
+  double ghostFirst;
+  double onLast[CHANNELS];
+  double ghostLast;
+  std::vector<double> periods;
+  unsigned long writes;
+  double isrStart;
+  double isrDue;       // when the running interrupt's timer came due
+  unsigned long stalls;
+  double longestGap;   // us between two interrupts
+  // handoff
+  bool handoff;
+  uint32_t refreshLit; // channels lit since column 0 last came on
+  uint32_t frameA;     // channels of the two frames
+  uint32_t frameB;
+  unsigned long refreshes;
+  unsigned long torn;
+};
+Replay rep;
+Rng rng;
+
+// the longest plane twice over plus the latency, a restarted plane is late
+// by less than that, a wrapped count by far more
+static double stallUs(){
+  return 2.0 * (DISPLAY_BCM_BASE_TICKS << (DISPLAY_BCM_BITS - 1)) * DISPLAY_TICK_US + opt.latencyUs;
+}
+
+static bool pinHigh(uint8_t pin){
+  return *portOutputRegister(digitalPinToPort(pin)) & digitalPinToBitMask(pin);
+}
+
+// channels lit by the pins right now, a led needs its ground and colour high
+static uint32_t litChannels(){
+  uint32_t lit = 0;
+  for(int x = 0; x < ROW; x++){
+    for(int y = 0; y < COL; y++){
+      if(!pinHigh(hwBoardPin(x, y, 0)))
+        continue;
+      for(int c = 0; c < RGB; c++){
+        if(pinHigh(hwBoardPin(x, y, c+1)))
+          lit |= 1UL << ((x*COL + y)*RGB + c);
+      }
+    }
+  }
+  return lit;
+}
+
+static void account(double now){
+  if(!rep.recording){
+    rep.lastNs = now;
+    return;
+  }
+  double span = now - rep.lastNs;
+  for(int ch = 0; ch < CHANNELS; ch++){
+    if(!(rep.lit & (1UL << ch)))
+      continue;
+    rep.on[ch] += span;
+    if(!(rep.expected & (1UL << ch)))
+      rep.ghostNs += span;
+  }
+  rep.lastNs = now;
+}
+
+static uint32_t isrClock(bool start){
+  double due = micros() * 1000.0;
+  if(start){
+    // a new interrupt, it may start late but never before the last one ended
+    if(rep.isrDue > 0){
+      double gap = (due - rep.isrDue) / 1000;
+      rep.longestGap = fmax(rep.longestGap, gap);
+      if(gap > stallUs())
+        rep.stalls++;
+    }
+    rep.isrDue = due;
+    rep.writes = 0;
+    rep.isrStart = due;
+    if(opt.latencyUs)
+      rep.isrStart += rngNext(rng) % (opt.latencyUs * 1000 + 1);
+    if(rep.isrStart < rep.lastNs)
+      rep.isrStart = rep.lastNs;
+    return 0;
+  }
+  return (uint32_t)(rep.isrStart + rep.writes * (double)opt.writeNs - due);
+}
+
+static void onPortWrite(volatile uint8_t *, uint8_t){
+  double now = rep.isrStart + rep.writes++ * (double)opt.writeNs;
+  account(now);
+
+  uint32_t lit = litChannels();
+  if(rep.recording && (lit & ~rep.expected & ~rep.lit))
+    rep.ghostWindows++;
+  rep.lit = lit;
+
+  bool high = rep.scanPin && pinHigh(rep.scanPin);
+  if(high && !rep.scanHigh && rep.recording){
+    if(rep.periods.empty() && rep.firstScan < 0){
+      rep.firstScan = now;
+      memcpy(rep.onFirst, rep.on, sizeof(rep.on));
+      rep.ghostFirst = rep.ghostNs;
+    }else{
+      rep.periods.push_back(now - rep.lastScan);
+    }
+    memcpy(rep.onLast, rep.on, sizeof(rep.on));
+    rep.ghostLast = rep.ghostNs;
+    rep.lastScan = now;
+  }
+  if(rep.handoff && high && !rep.scanHigh){
+    // a refresh ended, it may only have shown one of the two frames
+    if(rep.refreshes++ && (rep.refreshLit & rep.frameA) && (rep.refreshLit & rep.frameB))
+      rep.torn++;
+    rep.refreshLit = 0;
+  }
+  rep.refreshLit |= lit;
+  rep.scanHigh = high;
+}
+
+// patterns -------------------------------------------------------------------
+struct Pattern {
+  const char *name;
+  bool uniform;      // every lit led has the same colour
+  void (*fill)();    // sets game.color, NULL == allOff()
+};
+
+static void fillAll(uint8_t r, uint8_t g, uint8_t b){
+  for(int x = 0; x < ROW; x++){
+    for(int y = 0; y < COL; y++)
+      game.color[x][y] = LedColor{r, g, b, r || g || b};
+  }
+}
+
+const Pattern PATTERNS[] = {
+  {"white", true, []{ fillAll(LED_MAX, LED_MAX, LED_MAX); }},
+  {"white 8", true, []{ fillAll(8, 8, 8); }},
+  {"white 3", true, []{ fillAll(3, 3, 3); }},
+  {"red", true, []{ fillAll(LED_MAX, 0, 0); }},
+  {"checker", true, []{
+    fillAll(0, 0, 0);
+    for(int cell = 0; cell < LEDS; cell += 2)
+      game.color[cell / COL][cell % COL] = LedColor{LED_MAX, LED_MAX, LED_MAX, 1};
+  }},
+  {"one led", true, []{
+    fillAll(0, 0, 0);
+    game.color[1][1] = LedColor{LED_MAX, LED_MAX, LED_MAX, 1};
+  }},
+  {"game", false, []{
+    // X red, O blue, like a game in progress
+    const char *board = "XO.OX..XO";
+    fillAll(0, 0, 0);
+    for(int cell = 0; cell < LEDS; cell++){
+      if(board[cell] == 'X')
+        game.color[cell / COL][cell % COL] = LedColor{LED_MAX, 0, 0, 1};
+      else if(board[cell] == 'O')
+        game.color[cell / COL][cell % COL] = LedColor{0, 0, LED_MAX, 1};
+    }
+  }},
+  {"off", false, NULL},
+};
+const int NUM_PATTERNS = sizeof(PATTERNS) / sizeof(PATTERNS[0]);
+
+struct Result {
+  double refresh;     // Hz, 0 == no lit column to time
+  double periodSd;    // us
+  double periodMin;
+  double periodMax;
+  double uniformity;  // 1 == even, 0 == nothing to compare
+  double ghost;       // us per second
+  unsigned long ghostWindows;
+  double duty[CHANNELS];
+};
+
+static uint32_t expectedChannels(){
+  uint32_t lit = 0;
+  for(int x = 0; x < ROW; x++){
+    for(int y = 0; y < COL; y++){
+      const LedColor &c = game.color[x][y];
+      if(!c.on)
+        continue;
+      for(int ch = 0; ch < RGB; ch++){
+        if(ledLevel(c, ch))
+          lit |= 1UL << ((x*COL + y)*RGB + ch);
+      }
+    }
+  }
+  return lit;
+}
+
+static Result measure(const Pattern &p){
+  if(p.fill){
+    p.fill();
+    game.dirty = true;
+    drawBoard();
+  }else{
+    memset(game.color, 0, sizeof(game.color));
+    allOff();
+  }
+  rep.expected = expectedChannels();
+  rep.scanPin = 0;
+  for(int y = COL - 1; y >= 0; y--){
+    for(int x = 0; x < ROW; x++){
+      if(rep.expected & (7UL << (x*COL + y)*RGB))
+        rep.scanPin = hwBoardPin(x, y, 0);
+    }
+  }
+  halAdvance(WARMUP_US);
+
+  rep.recording = true;
+  rep.startNs = rep.lastNs;
+  memset(rep.on, 0, sizeof(rep.on));
+  rep.ghostNs = 0;
+  rep.ghostWindows = 0;
+  rep.periods.clear();
+  rep.firstScan = -1;
+  halAdvance(opt.windowMs * 1000);
+  account(micros() * 1000.0);
+  rep.recording = false;
+
+  Result r = {};
+  double window = rep.lastNs - rep.startNs;
+  if(!rep.periods.empty()){
+    // whole refreshes only, from the first to the last start of the column
+    window = rep.lastScan - rep.firstScan;
+    for(int ch = 0; ch < CHANNELS; ch++)
+      rep.on[ch] = rep.onLast[ch] - rep.onFirst[ch];
+    rep.ghostNs = rep.ghostLast - rep.ghostFirst;
+  }
+  for(int ch = 0; ch < CHANNELS; ch++)
+    r.duty[ch] = rep.on[ch] / window;
+  r.ghost = rep.ghostNs / window * 1e6;
+  r.ghostWindows = rep.ghostWindows;
+
+  if(!rep.periods.empty()){
+    double sum = 0, sq = 0;
+    r.periodMin = r.periodMax = rep.periods[0] / 1000;
+    for(double ns : rep.periods){
+      double us = ns / 1000;
+      sum += us;
+      sq += us * us;
+      r.periodMin = fmin(r.periodMin, us);
+      r.periodMax = fmax(r.periodMax, us);
+    }
+    double mean = sum / rep.periods.size();
+    r.refresh = 1e6 / mean;
+    r.periodSd = sqrt(fmax(0, sq / rep.periods.size() - mean * mean));
+  }
+
+  // per colour, dimmest over brightest of the leds that are lit with it
+  if(p.uniform){
+    r.uniformity = 1;
+    for(int c = 0; c < RGB; c++){
+      double lo = -1, hi = 0;
+      for(int led = 0; led < LEDS; led++){
+        int ch = led*RGB + c;
+        if(!(rep.expected & (1UL << ch)))
+          continue;
+        lo = lo < 0 ? r.duty[ch] : fmin(lo, r.duty[ch]);
+        hi = fmax(hi, r.duty[ch]);
+      }
+      if(hi > 0)
+        r.uniformity = fmin(r.uniformity, lo / hi);
+    }
+  }
+  return r;
+}
+
+// publishes the two frames at random times for the window, returns how many
+static unsigned long handoff(){
+  fillAll(0, 0, LED_MAX);
+  rep.frameB = expectedChannels();
+  fillAll(LED_MAX, 0, 0);
+  rep.frameA = expectedChannels();
+  game.dirty = true;
+  drawBoard();
+  rep.scanPin = hwBoardPin(0, 0, 0);
+  halAdvance(WARMUP_US);
+
+  rep.handoff = true;
+  rep.refreshes = 0;
+  rep.torn = 0;
+  unsigned long frames = 0;
+  uint32_t end = micros() + opt.windowMs * 1000;
+  bool red = true;
+  while((int32_t)(micros() - end) < 0){
+    halAdvance(1 + rngNext(rng) % HANDOFF_MAX_GAP_US);
+    red = !red;
+    fillAll(red ? LED_MAX : 0, 0, red ? 0 : LED_MAX);
+    game.dirty = true;
+    drawBoard();
+    frames++;
+  }
+  rep.handoff = false;
+  return frames;
+}
+
+// a led as the eye sees it, duty is linear and the terminal expects sRGB
+static int shade(double duty){
+  double full = duty * GNDS; // one column of the scan is the most a led gets
+  return (int)lround(255 * pow(fmin(full, 1.0), 1 / 2.2));
+}
+
+static void render(const Result &r){
+  bool color = isatty(STDOUT_FILENO);
+  for(int x = 0; x < ROW; x++){
+    printf("    ");
+    for(int y = 0; y < COL; y++){
+      const double *d = &r.duty[(x*COL + y)*RGB];
+      if(color)
+        printf("\x1b[38;2;%d;%d;%dm██\x1b[0m ", shade(d[0]), shade(d[1]), shade(d[2]));
+      else
+        printf("%c ", d[0] + d[1] + d[2] > 0 ? '#' : '.');
+    }
+    printf("  ");
+    for(int y = 0; y < COL; y++){
+      const double *d = &r.duty[(x*COL + y)*RGB];
+      printf(" %5.2f/%5.2f/%5.2f%%", 100*d[0], 100*d[1], 100*d[2]);
+    }
+    printf("\n");
+  }
+}
+
+static void usage(){
+  fprintf(stderr, "usage: matrixsim [-c] [-q] [-t ms] [-l us] [-w ns] [-s seed] [-r hz] [-u ratio] [-g us]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  for(int i = 1; i < argc; i++){
+    if(!strcmp(argv[i], "-c")){
+      opt.check = true;
+      continue;
+    }
+    if(!strcmp(argv[i], "-q")){
+      opt.quiet = true;
+      continue;
+    }
+    if(i + 1 >= argc)
+      usage();
+    const char *v = argv[++i];
+    if(!strcmp(argv[i-1], "-t"))
+      opt.windowMs = strtoul(v, NULL, 0);
+    else if(!strcmp(argv[i-1], "-l"))
+      opt.latencyUs = strtoul(v, NULL, 0);
+    else if(!strcmp(argv[i-1], "-w"))
+      opt.writeNs = strtoul(v, NULL, 0);
+    else if(!strcmp(argv[i-1], "-s"))
+      opt.seed = strtoul(v, NULL, 0);
+    else if(!strcmp(argv[i-1], "-r"))
+      opt.minRefresh = atof(v);
+    else if(!strcmp(argv[i-1], "-u"))
+      opt.minUniformity = atof(v);
+    else if(!strcmp(argv[i-1], "-g"))
+      opt.maxGhost = atof(v);
+    else
+      usage();
+  }
+  if(opt.windowMs < 10)
+    opt.windowMs = 10;
+
+  rngSeed(rng, opt.seed);
+  halUseSimClock(true);
+  halTracePorts(onPortWrite);
+  halTraceIsr(isrClock);
+  displayBegin();
+
+  printf("%lu ms per pattern, interrupts up to %lu us late, %lu ns per port write\n",
+         opt.windowMs, opt.latencyUs, opt.writeNs);
+  printf("%-9s %10s %22s %11s %11s %8s\n", "pattern", "refresh Hz", "period us sd min-max", "uniformity", "ghost us/s", "windows");
+  int failures = 0;
+  for(int i = 0; i < NUM_PATTERNS; i++){
+    const Pattern &p = PATTERNS[i];
+    Result r = measure(p);
+    char period[32] = "-";
+    if(r.refresh > 0)
+      snprintf(period, sizeof(period), "%.1f %.0f-%.0f", r.periodSd, r.periodMin, r.periodMax);
+    char uniformity[16] = "-";
+    if(p.uniform)
+      snprintf(uniformity, sizeof(uniformity), "%.4f", r.uniformity);
+    printf("%-9s %10.1f %22s %11s %11.2f %8lu\n", p.name, r.refresh, period, uniformity, r.ghost, r.ghostWindows);
+    if(!opt.quiet)
+      render(r);
+
+    if(!opt.check)
+      continue;
+    if(p.fill && r.refresh < opt.minRefresh){
+      printf("  FAIL refresh %.1f Hz < %.1f\n", r.refresh, opt.minRefresh);
+      failures++;
+    }
+    if(p.uniform && r.uniformity < opt.minUniformity){
+      printf("  FAIL uniformity %.4f < %.4f\n", r.uniformity, opt.minUniformity);
+      failures++;
+    }
+    if(r.ghost > opt.maxGhost){
+      printf("  FAIL ghosting %.2f us/s > %.2f\n", r.ghost, opt.maxGhost);
+      failures++;
+    }
+  }
+  unsigned long frames = handoff();
+  printf("%-9s %lu frames over %lu refreshes, %lu torn\n", "handoff", frames, rep.refreshes, rep.torn);
+  if(opt.check && rep.torn){
+    printf("  FAIL %lu torn frames\n", rep.torn);
+    failures++;
+  }
+  printf("%-9s %lu gaps over %.0f us, longest %.0f us\n", "stalls", rep.stalls, stallUs(), rep.longestGap);
+  if(opt.check && rep.stalls){
+    printf("  FAIL %lu scan stalls\n", rep.stalls);
+    failures++;
+  }
+  if(opt.check)
+    printf("%d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+/*
+  *@mctsbench overview
+  *           host tool, plays the firmware's MCTS (mcts.h, same code and
+  *           arena size as AI_MCTS) against the other AI modes
+  *                 |-> mcts vs random   both colours
+  *                 |-> mcts vs smart    both colours, smart never loses so
+  *                                      every mcts loss is a blunder
+  *                 |-> deep         X to win in one (cell 2) searched with
+  *                                      the most playouts mcts allows, must
+  *                                      pick the win and score it as one,
+  *                                      catches a 16 bit score that wraps
+  *           prints results, playouts per second and how much of the tree
+  *           each move got to keep from the last one
+  *           exit code 1 if the deep row fails
+  *
+  *           pio run -e mctsbench && .pio/build/mctsbench/program [-g games]
+  *                 [-p playouts] [-s seed]
+  *
+*/
+
+#include "hal.h"
+#include "ai.h"
+#include "mcts.h"
+#include "bitboard.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum Opponent { RANDOM, SMART, NUM_OPPONENTS };
+const char *OPPONENT_NAME[NUM_OPPONENTS] = {"random", "smart"};
+
+struct Stats {
+  unsigned long games;
+  unsigned long wins;     // for mcts
+  unsigned long draws;
+  unsigned long losses;
+  unsigned long moves;    // mcts moves
+  unsigned long playouts;
+  unsigned long reused;   // nodes kept from the previous move
+  double seconds;         // inside mcts
+};
+
+static double now(){
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void playGame(Opponent opponent, bool mctsX, uint16_t playouts, Rng &rng, Stats &s){
+  Board b = {0, 0};
+  while(bbWinner(b) == -1 && bbEmpty(b)){
+    bool xTurn = bbXTurn(b);
+    int cell;
+    if(xTurn == mctsX){
+      double start = now();
+      mctsBegin(b, playouts);
+      while(!mctsStep(UINT32_MAX)){
+      }
+      s.seconds += now() - start;
+      s.moves++;
+      s.playouts += mctsPlayouts();
+      s.reused += mctsNodesReused();
+      cell = mctsMove();
+    }else{
+      cell = opponent == RANDOM ? aiRandomMove(b, rng) : aiBestMove(b);
+    }
+    bbPlace(b, cell, xTurn);
+  }
+  int winner = bbWinner(b);
+  s.games++;
+  if(winner == -1)
+    s.draws++;
+  else if(winner == (int)mctsX)
+    s.wins++;
+  else
+    s.losses++;
+}
+
+// the search runs until MCTS_MAX_VISITS, a winning child's score is twice that
+static bool checkDeep(){
+  Board b = {0003, 0030};
+  double start = now();
+  mctsBegin(b, UINT16_MAX);
+  while(!mctsStep(UINT32_MAX)){
+  }
+  double seconds = now() - start;
+  int cell = mctsMove();
+  float value = mctsValue();
+  bool ok = cell == 2 && value > 0.99f;
+  printf("%-8s %-6s cell %d value %.3f, %lu playouts, %12.0f playouts/s, %s\n", "deep", "X",
+         cell, value, mctsPlayouts(), seconds > 0 ? mctsPlayouts() / seconds : 0.0,
+         ok ? "ok" : "FAILED");
+  return ok;
+}
+
+static void usage(){
+  fprintf(stderr, "usage: mctsbench [-g games] [-p playouts] [-s seed]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  unsigned long games = 1000;
+  unsigned long playouts = MCTS_PLAYOUTS;
+  uint32_t seed = 1;
+  for(int i = 1; i < argc; i++){
+    if(i + 1 >= argc)
+      usage();
+    if(!strcmp(argv[i], "-g"))
+      games = strtoul(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "-p"))
+      playouts = strtoul(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "-s"))
+      seed = strtoul(argv[++i], NULL, 0);
+    else
+      usage();
+  }
+  if(playouts > UINT16_MAX)
+    playouts = UINT16_MAX;
+
+  Rng rng;
+  rngSeed(rng, seed);
+  mctsSeed(seed * 2654435761u);
+
+  printf("%u arena nodes (%u bytes), %lu playouts per move, %lu games per row\n",
+         MCTS_NODES, (unsigned)(MCTS_NODES * sizeof(MctsNode)), playouts, games);
+  printf("%-8s %-6s %8s %8s %8s %12s %12s\n", "vs", "mcts", "win%", "draw%", "loss%", "playouts/s", "reused/move");
+  unsigned long blunders = 0;
+  for(int o = 0; o < NUM_OPPONENTS; o++){
+    for(int side = 1; side >= 0; side--){
+      Stats s = {};
+      for(unsigned long g = 0; g < games; g++)
+        playGame((Opponent)o, side, playouts, rng, s);
+      if(o == SMART)
+        blunders += s.losses;
+      printf("%-8s %-6s %8.2f %8.2f %8.2f %12.0f %12.1f\n", OPPONENT_NAME[o], side ? "X" : "O",
+             100.0 * s.wins / s.games, 100.0 * s.draws / s.games, 100.0 * s.losses / s.games,
+             s.seconds > 0 ? s.playouts / s.seconds : 0.0, s.moves ? (double)s.reused / s.moves : 0.0);
+    }
+  }
+  bool deep = checkDeep();
+  printf("%lu losses against perfect play\n", blunders);
+  return deep ? 0 : 1;
+}
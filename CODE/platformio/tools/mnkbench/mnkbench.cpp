@@ -0,0 +1,315 @@
+/*
+  *@mnkbench overview
+  *           host tool, checks the m,n,k engine (mnk.h) and times it on the
+  *           bigger boards
+  *                 |-> lines        Mnk<3, 3, 3>'s generated lines must be
+  *                                  bitboard.h's table
+  *                 |-> tic-tac-toe  every reachable position, Deepening<>
+  *                                  without a budget must give the move
+  *                                  table's score and a move that keeps it
+  *                 |-> 4x4          book4.h positions with BOOK4_PLIES
+  *                                  pieces (every -s th), a full search
+  *                                  without the book must give the book's
+  *                                  score, the book lookup must agree in
+  *                                  every orientation and its moves keep
+  *                                  the score
+  *                 |-> play         4x4 k=4 and 5x5 k=4, Deepening<> with a
+  *                                  node (-n) or time (-t us) budget per
+  *                                  move, stepped in SLICE_US slices like
+  *                                  the loop's AI task, against a random
+  *                                  player, both sides, reports the depth
+  *                                  reached and the slowest move
+  *           exit code 1 on any difference, the play results are only
+  *           reported
+  *
+  *           pio run -e mnkbench && .pio/build/mnkbench/program
+  *               [-n nodes] [-t us] [-g games] [-s step]
+  *
+*/
+
+#include "hal.h"
+#include "bitboard.h"
+#include "engine.h"
+#include "mnk.h"
+#include "book4.h"
+#include "movetable.h"
+#include "rng.h"
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+const size_t MAX_REPORTED = 20;
+const unsigned long SLICE_US = 2000;
+
+static double now(){
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// lines ---------------------------------------------------------------------
+typedef Mnk<3, 3, 3> Ttt;
+
+static int checkLines(){
+  int differences = Ttt::LINES.COUNT == BB_NUM_LINES ? 0 : 1;
+  for(uint8_t i = 0; i < BB_NUM_LINES && !differences; i++){
+    if(Ttt::LINES.mask[i] != BB_LINES[i]){
+      printf("  line %d: %03o, bitboard.h %03o\n", i, (unsigned)Ttt::LINES.mask[i], BB_LINES[i]);
+      differences++;
+    }
+  }
+  printf("lines: 3x3 k=3 %d, 4x4 k=4 %d, 5x5 k=4 %d, %s bitboard.h\n\n",
+         Ttt::LINES.COUNT, Mnk<4, 4, 4>::LINES.COUNT, Mnk<5, 5, 4>::LINES.COUNT,
+         differences ? "differ from" : "same as");
+  return differences;
+}
+
+// tic-tac-toe ---------------------------------------------------------------
+Deepening<Ttt> tttSearch;
+
+// exact score of b on the Mnk scale, from the move table
+static int tableScore(const Board &b){
+  int winner = bbWinner(b);
+  if(winner != -1)
+    return winner ? Ttt::WIN : -Ttt::WIN;
+  if(!bbEmpty(b))
+    return 0;
+  uint8_t e = mtLookup(b);
+  int score = bbXTurn(b) ? mtScore(e) : -mtScore(e);
+  // the table counts down from 10, plies from the position are the same
+  return score > 0 ? Ttt::WIN - (10 - score) : score < 0 ? -Ttt::WIN + (10 + score) : 0;
+}
+static int tableBack(int score){
+  return score > 0 ? score - 1 : score < 0 ? score + 1 : 0;
+}
+
+static void checkTicTacToe(const Board &b, std::vector<bool> &seen, unsigned long &positions,
+                           unsigned long &nodes, int &differences){
+  uint16_t idx = 0, pow3 = 1;
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++, pow3 *= 3){
+    if(b.x & bbBit(cell))
+      idx += pow3;
+    else if(b.o & bbBit(cell))
+      idx += 2*pow3;
+  }
+  if(seen[idx])
+    return;
+  seen[idx] = true;
+  if(bbWinner(b) != -1 || !bbEmpty(b))
+    return;
+  positions++;
+
+  tttSearch.begin(Ttt::start(b.x, b.o));
+  while(!tttSearch.step(UINT32_MAX)){
+  }
+  nodes += tttSearch.nodes();
+  int best = tableScore(b);
+  int move = tttSearch.move();
+  bool legal = move < BB_CELLS && (bbEmpty(b) & bbBit(move));
+  Board child = b;
+  if(legal)
+    bbPlace(child, move, bbXTurn(b));
+  if(tttSearch.score() != best || !legal || tableBack(tableScore(child)) != best){
+    if(differences++ < (int)MAX_REPORTED){
+      printf("  x %03o o %03o: deepening %d/%d depth %d, table %d\n",
+             b.x, b.o, move, tttSearch.score(), tttSearch.depth(), best);
+    }
+  }
+
+  uint16_t empty = bbEmpty(b);
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    if(empty & bbBit(cell)){
+      Board next = b;
+      bbPlace(next, cell, bbXTurn(b));
+      checkTicTacToe(next, seen, positions, nodes, differences);
+    }
+  }
+}
+
+static int benchTicTacToe(){
+  std::vector<bool> seen(19683);
+  unsigned long positions = 0, nodes = 0;
+  int differences = 0;
+  double start = now();
+  checkTicTacToe(Board{0, 0}, seen, positions, nodes, differences);
+  printf("tic-tac-toe (3x3 k=3), %lu positions, %lu nodes, %.3fs, %d differences\n\n",
+         positions, nodes, now() - start, differences);
+  return differences;
+}
+
+// 4x4 -----------------------------------------------------------------------
+typedef Mnk<4, 4, 4> Four;
+Engine<Four> fourEngine;
+
+static uint32_t transform4(uint32_t m, int sym){
+  uint32_t out = 0;
+  for(int c = 0; c < 16; c++){
+    if(!(m & (1u << c)))
+      continue;
+    int x = c / 4, y = c % 4;
+    if(sym & 1)
+      y = 3 - y;
+    if(sym & 2)
+      x = 3 - x;
+    if(sym & 4){
+      int t = x;
+      x = y;
+      y = t;
+    }
+    out |= 1u << (x*4 + y);
+  }
+  return out;
+}
+
+static int benchFour(int sampleStep){
+  unsigned long positions = 0, nodes = 0, lookups = 0;
+  int differences = 0;
+  double seconds = 0;
+  for(uint16_t i = 0; i < BOOK4_SIZE; i++){
+    uint32_t x = BOOK4_KEYS[i] >> 16, o = BOOK4_KEYS[i] & 0xFFFF;
+    Four::State s = Four::start(x, o);
+    Four::Move bookMove;
+    int bookScore;
+    if(!Four::book(s, bookMove, bookScore)){
+      printf("  x %04x o %04x: not found in the book\n", (unsigned)x, (unsigned)o);
+      differences++;
+      continue;
+    }
+    // every orientation must find the same score and a move that keeps
+    // it, symmetric positions can turn into a different best move
+    for(int sym = 0; sym < 8; sym++){
+      Four::State t = Four::start(transform4(x, sym), transform4(o, sym));
+      Four::Move m;
+      int score;
+      lookups++;
+      bool same = Four::book(t, m, score) && score == bookScore && m < Four::CELLS
+                  && (Four::empty(t) & Four::bit(m));
+      if(same && mnkCount(x | o) < BOOK4_PLIES){
+        Four::make(t, m);
+        Four::Move next;
+        int after;
+        if(Four::terminal(t))
+          after = Four::evaluate(t);
+        else
+          same = Four::book(t, next, after);
+        same = same && (after > 0 ? after - 1 : after < 0 ? after + 1 : 0) == score;
+      }
+      if(!same && differences++ < (int)MAX_REPORTED)
+        printf("  x %04x o %04x sym %d: book lookup differs\n", (unsigned)x, (unsigned)o, sym);
+    }
+
+    if(mnkCount(x | o) != BOOK4_PLIES || i % sampleStep)
+      continue;
+    positions++;
+    double start = now();
+    fourEngine.begin(s);
+    while(!fourEngine.step(UINT32_MAX)){
+    }
+    seconds += now() - start;
+    nodes += fourEngine.nodes();
+    if(fourEngine.score() != bookScore){
+      if(differences++ < (int)MAX_REPORTED){
+        printf("  x %04x o %04x: engine %d/%d, book %d/%d\n", (unsigned)x, (unsigned)o,
+               fourEngine.move(), fourEngine.score(), bookMove, bookScore);
+      }
+    }
+  }
+  printf("4x4 k=4, %lu book lookups in every orientation, %lu %d-piece positions searched\n",
+         lookups, positions, BOOK4_PLIES);
+  printf("  %lu nodes, %.3fs, %.0f nodes/s, %d differences\n\n",
+         nodes, seconds, seconds > 0 ? nodes / seconds : 0.0, differences);
+  return differences;
+}
+
+// play ----------------------------------------------------------------------
+template <class Game>
+struct PlayStats {
+  int won = 0, drawn = 0, lost = 0;
+  unsigned long moves = 0, depths = 0, nodes = 0;
+  double seconds = 0, slowest = 0;
+};
+
+template <class Game>
+static void playGame(Deepening<Game> &search, bool aiX, unsigned long budget, unsigned long budgetUs,
+                     Rng &rng, PlayStats<Game> &stats){
+  typename Game::State s = Game::start();
+  while(!Game::terminal(s)){
+    typename Game::Move m;
+    if(s.xTurn == aiX){
+      double start = now();
+      search.begin(s, budget, budgetUs);
+      while(!search.step(SLICE_US)){
+      }
+      double seconds = now() - start;
+      m = search.move();
+      stats.moves++;
+      stats.depths += search.depth();
+      stats.nodes += search.nodes();
+      stats.seconds += seconds;
+      if(seconds > stats.slowest)
+        stats.slowest = seconds;
+    }else{
+      uint32_t empty = Game::empty(s);
+      uint8_t pick = rngBelow(rng, mnkCount(empty));
+      for(m = 0; !(empty & Game::bit(m)) || pick--; m++){
+      }
+    }
+    Game::make(s, m);
+  }
+  if(s.winner == -1)
+    stats.drawn++;
+  else if(s.winner == aiX)
+    stats.won++;
+  else
+    stats.lost++;
+}
+
+template <class Game>
+static void benchPlay(const char *name, int games, unsigned long budget, unsigned long budgetUs){
+  static Deepening<Game> search;
+  PlayStats<Game> stats;
+  Rng rng;
+  rngSeed(rng, 1);
+  for(int g = 0; g < games; g++)
+    playGame(search, g % 2 == 0, budget, budgetUs, rng, stats);
+  printf("%-8s %4d games: won %3d drawn %3d lost %3d, mean depth %5.2f, %7.0f nodes/move, "
+         "mean %6.2fms slowest %6.2fms\n", name, games, stats.won, stats.drawn, stats.lost,
+         stats.moves ? (double)stats.depths / stats.moves : 0.0,
+         stats.moves ? (double)stats.nodes / stats.moves : 0.0,
+         stats.moves ? 1000 * stats.seconds / stats.moves : 0.0, 1000 * stats.slowest);
+}
+
+static void usage(){
+  fprintf(stderr, "usage: mnkbench [-n nodes] [-t us] [-g games] [-s step]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  unsigned long budget = 20000, budgetUs = 0;
+  int games = 20, sampleStep = 8;
+  for(int i = 1; i < argc; i++){
+    if(i + 1 >= argc)
+      usage();
+    if(!strcmp(argv[i], "-n"))
+      budget = strtoul(argv[++i], nullptr, 10);
+    else if(!strcmp(argv[i], "-t"))
+      budgetUs = strtoul(argv[++i], nullptr, 10);
+    else if(!strcmp(argv[i], "-g"))
+      games = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-s"))
+      sampleStep = atoi(argv[++i]);
+    else
+      usage();
+  }
+  if(sampleStep < 1)
+    sampleStep = 1;
+
+  int differences = checkLines();
+  differences += benchTicTacToe();
+  differences += benchFour(sampleStep);
+  printf("against a random player, %lu nodes, %luus per move (0 == no limit)\n", budget, budgetUs);
+  benchPlay<Mnk<4, 4, 4>>("4x4 k=4", games, budget, budgetUs);
+  benchPlay<Mnk<5, 5, 4>>("5x5 k=4", games, budget, budgetUs);
+  return differences ? 1 : 0;
+}
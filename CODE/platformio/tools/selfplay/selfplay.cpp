@@ -0,0 +1,370 @@
+/*
+  *@selfplay overview
+  *           host tool that certifies the AI before it goes on a board
+  *           plays the engine (ai.h, same code as AI_SMART) on every core and
+  *           checks each of its moves against an independent solver
+  *                 |-> smart vs random   both colours, seeded per task
+  *                 |-> smart vs smart
+  *                 |-> openings          smart vs smart from every reachable
+  *                                       position
+  *                 |-> all replies       smart against every possible line
+  *                                       of the other side
+  *           games are cut into tasks on a work stealing pool, each worker
+  *           pops its own deque from the back and steals from the front of
+  *           the others when it runs dry
+  *           exit code 1 if smart ever loses or plays a worse move
+  *
+  *           pio run -e selfplay && .pio/build/selfplay/program [-g games]
+  *                 [-t threads] [-s seed] [-b games per task]
+  *
+*/
+
+#include "hal.h"
+#include "ai.h"
+#include "bitboard.h"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+const uint16_t REF_POSITIONS = 19683; // 3^9
+const int REF_UNKNOWN = 127;
+const size_t MAX_REPORTED = 20;
+
+// reference -----------------------------------------------------------------
+// plain memoised minimax, shares nothing with the engine but bitboard.h
+// score on the utility() scale seen from X, 10 minus the plies to the win
+int8_t refScore[REF_POSITIONS];
+
+static uint16_t refIndex(const Board &b){
+  uint16_t idx = 0, pow3 = 1;
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++, pow3 *= 3){
+    if(b.x & bbBit(cell))
+      idx += pow3;
+    else if(b.o & bbBit(cell))
+      idx += 2*pow3;
+  }
+  return idx;
+}
+// one ply further from the root, a win or loss counts one less
+static int refBack(int score){
+  return score > 0 ? score - 1 : score < 0 ? score + 1 : 0;
+}
+static int refSolve(const Board &b){
+  int8_t &memo = refScore[refIndex(b)];
+  if(memo != REF_UNKNOWN)
+    return memo;
+  int best;
+  if(bbHasLine(b.x)){
+    best = 10;
+  }else if(bbHasLine(b.o)){
+    best = -10;
+  }else if(!bbEmpty(b)){
+    best = 0;
+  }else{
+    bool xTurn = bbXTurn(b);
+    best = xTurn ? -100 : 100;
+    uint16_t empty = bbEmpty(b);
+    for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+      if(!(empty & bbBit(cell)))
+        continue;
+      Board child = b;
+      bbPlace(child, cell, xTurn);
+      int score = refBack(refSolve(child));
+      if(xTurn ? score > best : score < best)
+        best = score;
+    }
+  }
+  memo = best;
+  return best;
+}
+static bool refTerminal(const Board &b){
+  return bbHasLine(b.x) || bbHasLine(b.o) || !bbEmpty(b);
+}
+
+// results -------------------------------------------------------------------
+enum Matchup { SMART_RANDOM, SMART_SMART, OPENINGS, ALL_REPLIES, NUM_MATCHUPS };
+const char *MATCHUP_NAME[NUM_MATCHUPS] = {"smart vs random", "smart vs smart", "openings", "all replies"};
+
+struct Stats {
+  uint64_t games;
+  uint64_t xWins;
+  uint64_t oWins;
+  uint64_t draws;
+  uint64_t smartLosses;  // smart was on the losing side
+  uint64_t suboptimal;   // smart moves that score worse than the best
+  uint64_t moves;        // smart moves checked
+};
+
+struct Failure {
+  Board board;
+  int move;
+  int score;      // what the engine said the position is worth
+  int moveScore;  // what its move is really worth
+  int best;
+  bool lost;
+};
+
+std::mutex failureLock;
+std::vector<Failure> failures;
+std::atomic<uint64_t> failureCount;
+
+static void report(const Failure &f){
+  failureCount++;
+  std::lock_guard<std::mutex> guard(failureLock);
+  if(failures.size() < MAX_REPORTED)
+    failures.push_back(f);
+}
+
+// one smart move, checked against the reference
+static int smartMove(const Board &b, Stats &s){
+  int score;
+  int move = aiBestMove(b, score);
+  int best = refSolve(b);
+  s.moves++;
+  bool legal = move >= 0 && move < BB_CELLS && (bbEmpty(b) & bbBit(move));
+  int moveScore = 0;
+  if(legal){
+    Board child = b;
+    bbPlace(child, move, bbXTurn(b));
+    moveScore = refBack(refSolve(child));
+  }
+  if(!legal || moveScore != best || score != best){
+    s.suboptimal++;
+    report({b, move, score, moveScore, best, false});
+  }
+  return move;
+}
+
+// play to the end, smartSide bit 1 == smart plays X, bit 0 == smart plays O
+static void playOut(Board b, uint8_t smartSide, Rng &rng, Stats &s){
+  while(!refTerminal(b)){
+    bool xTurn = bbXTurn(b);
+    int move = (smartSide & (xTurn ? 2 : 1)) ? smartMove(b, s) : aiRandomMove(b, rng);
+    if(move < 0 || move >= BB_CELLS)
+      return;
+    bbPlace(b, move, xTurn);
+  }
+  s.games++;
+  int winner = bbWinner(b);
+  if(winner == 1)
+    s.xWins++;
+  else if(winner == 0)
+    s.oWins++;
+  else
+    s.draws++;
+  if((winner == 1 && !(smartSide & 2)) || (winner == 0 && !(smartSide & 1))){
+    s.smartLosses++;
+    report({b, -1, 0, 0, 0, true});
+  }
+}
+
+// smart on one side, every legal reply on the other
+static void allReplies(Board b, bool smartX, Stats &s){
+  if(refTerminal(b)){
+    Rng unused;
+    rngSeed(unused, 1);
+    playOut(b, smartX ? 2 : 1, unused, s);
+    return;
+  }
+  bool xTurn = bbXTurn(b);
+  if(xTurn == smartX){
+    bbPlace(b, smartMove(b, s), xTurn);
+    allReplies(b, smartX, s);
+    return;
+  }
+  uint16_t empty = bbEmpty(b);
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    if(empty & bbBit(cell)){
+      Board child = b;
+      bbPlace(child, cell, xTurn);
+      allReplies(child, smartX, s);
+    }
+  }
+}
+
+// work stealing pool --------------------------------------------------------
+struct Task {
+  Matchup matchup;
+  uint64_t first;  // first game, or first opening
+  uint64_t count;
+  uint32_t seed;
+};
+
+struct Worker {
+  std::mutex lock;
+  std::deque<Task> tasks;
+  Stats stats[NUM_MATCHUPS];
+};
+
+std::vector<Board> openings;
+
+static void runTask(const Task &t, Stats &s){
+  Rng rng;
+  rngSeed(rng, t.seed);
+  for(uint64_t i = t.first; i < t.first + t.count; i++){
+    switch(t.matchup){
+      case(SMART_RANDOM):
+        playOut(Board{0, 0}, (i & 1) ? 2 : 1, rng, s);
+        break;
+      case(SMART_SMART):
+        playOut(Board{0, 0}, 3, rng, s);
+        break;
+      case(OPENINGS):
+        playOut(openings[i], 3, rng, s);
+        break;
+      case(ALL_REPLIES):
+        allReplies(Board{0, 0}, i == 0, s);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+static bool takeTask(std::vector<Worker> &workers, size_t self, Task &t){
+  {
+    std::lock_guard<std::mutex> guard(workers[self].lock);
+    if(!workers[self].tasks.empty()){
+      t = workers[self].tasks.back();
+      workers[self].tasks.pop_back();
+      return true;
+    }
+  }
+  for(size_t k = 1; k < workers.size(); k++){
+    Worker &victim = workers[(self + k) % workers.size()];
+    std::lock_guard<std::mutex> guard(victim.lock);
+    if(!victim.tasks.empty()){
+      t = victim.tasks.front();
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+static void workerLoop(std::vector<Worker> &workers, size_t self){
+  Task t;
+  // tasks never spawn tasks, so empty everywhere means done
+  while(takeTask(workers, self, t)){
+    runTask(t, workers[self].stats[t.matchup]);
+  }
+}
+
+// every position a real game can reach that is not over yet
+static void collectOpenings(Board b, std::vector<bool> &seen){
+  uint16_t idx = refIndex(b);
+  if(seen[idx] || refTerminal(b))
+    return;
+  seen[idx] = true;
+  openings.push_back(b);
+  uint16_t empty = bbEmpty(b);
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++){
+    if(empty & bbBit(cell)){
+      Board child = b;
+      bbPlace(child, cell, bbXTurn(b));
+      collectOpenings(child, seen);
+    }
+  }
+}
+
+static void usage(){
+  fprintf(stderr, "usage: selfplay [-g games] [-t threads] [-s seed] [-b games per task]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  uint64_t games = 1000000;
+  unsigned threads = std::thread::hardware_concurrency();
+  uint32_t seed = 1;
+  uint64_t batch = 4096;
+  for(int i = 1; i < argc; i++){
+    if(i + 1 >= argc)
+      usage();
+    if(!strcmp(argv[i], "-g"))
+      games = strtoull(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "-t"))
+      threads = strtoul(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "-s"))
+      seed = strtoul(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "-b"))
+      batch = strtoull(argv[++i], NULL, 0);
+    else
+      usage();
+  }
+  if(threads == 0)
+    threads = 1;
+  if(batch == 0)
+    batch = 1;
+
+  memset(refScore, REF_UNKNOWN, sizeof(refScore));
+  refSolve(Board{0, 0});
+  std::vector<bool> seen(REF_POSITIONS);
+  collectOpenings(Board{0, 0}, seen);
+
+  // cut every matchup into tasks and deal them out round robin
+  std::vector<Worker> workers(threads);
+  const uint64_t total[NUM_MATCHUPS] = {games, games, openings.size(), 2};
+  size_t next = 0;
+  for(int m = 0; m < NUM_MATCHUPS; m++){
+    for(uint64_t first = 0; first < total[m]; first += batch){
+      uint64_t count = total[m] - first < batch ? total[m] - first : batch;
+      // distinct seeds per task, so a run repeats for the same -s and -b
+      uint32_t taskSeed = seed * 2654435761u ^ (uint32_t)(first / batch * 40503u + m);
+      workers[next++ % threads].tasks.push_back({(Matchup)m, first, count, taskSeed});
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  for(size_t t = 1; t < threads; t++)
+    pool.emplace_back(workerLoop, std::ref(workers), t);
+  workerLoop(workers, 0);
+  for(std::thread &t : pool)
+    t.join();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("%u threads, %zu openings, %.2fs\n", threads, openings.size(), seconds);
+  printf("%-16s %10s %8s %8s %8s %8s %10s\n", "matchup", "games", "X win%", "O win%", "draw%", "losses", "suboptimal");
+  uint64_t allGames = 0, allMoves = 0;
+  for(int m = 0; m < NUM_MATCHUPS; m++){
+    Stats s = {};
+    for(Worker &w : workers){
+      s.games += w.stats[m].games;
+      s.xWins += w.stats[m].xWins;
+      s.oWins += w.stats[m].oWins;
+      s.draws += w.stats[m].draws;
+      s.smartLosses += w.stats[m].smartLosses;
+      s.suboptimal += w.stats[m].suboptimal;
+      s.moves += w.stats[m].moves;
+    }
+    double pct = s.games ? 100.0 / s.games : 0;
+    printf("%-16s %10llu %8.2f %8.2f %8.2f %8llu %10llu\n", MATCHUP_NAME[m], (unsigned long long)s.games,
+           s.xWins * pct, s.oWins * pct, s.draws * pct,
+           (unsigned long long)s.smartLosses, (unsigned long long)s.suboptimal);
+    allGames += s.games;
+    allMoves += s.moves;
+  }
+  printf("%.0f games/s, %.0f checked smart moves/s\n", allGames / seconds, allMoves / seconds);
+
+  for(const Failure &f : failures){
+    if(f.lost){
+      printf("LOST   x=%03o o=%03o\n", f.board.x, f.board.o);
+    }else{
+      printf("WORSE  x=%03o o=%03o played %d worth %d, said %d, best %d\n",
+             f.board.x, f.board.o, f.move, f.moveScore, f.score, f.best);
+    }
+  }
+  if(failureCount){
+    printf("FAILED: %llu problems\n", (unsigned long long)failureCount.load());
+    return 1;
+  }
+  printf("PASSED\n");
+  return 0;
+}
@@ -0,0 +1,565 @@
+/*
+  *@server overview
+  *           host tool (Linux), hosts many games at once for the kiosk
+  *           front-ends, with the same rules and AI as the boards
+  *           (session.h), over a Unix domain stream socket
+  *                 |-> epoll       one thread, non blocking sockets, level
+  *                                 triggered, every connection has a line
+  *                                 buffer in and a byte buffer out
+  *                 |-> pool        sessions live in one array allocated at
+  *                                 start, free slots are a linked list, an
+  *                                 id is slot | generation << 20, so a stale
+  *                                 id never reaches the slot's next game
+  *                 |-> batches     a move that leaves the AI to play queues
+  *                                 the session, the queue runs once all
+  *                                 ready sockets are read, sorted by mode
+  *                                 and board so equal positions are worked
+  *                                 out once, for at most -b us before the
+  *                                 sockets get looked at again, that is
+  *                                 what bounds the tail
+  *           a connection owns the sessions it made, they go when it closes
+  *           requests, one per line, and replies
+  *                 new <mode> <x|o>   smart random mcts easy medium or 2p,
+  *                                    then the human's side
+  *                 move <id> <cell>   cell 0-8, (x,y) is cell x*3 + y
+  *                 show <id>
+  *                       -> "<id> <board> <state> <ai cell>"  board is 9 of
+  *                          x o . by cell, state x or o to move, xwins owins
+  *                          or draw, ai cell the AI's last move or -
+  *                 end <id>           -> "<id> end"
+  *                 stats              -> sessions, moves and latency of
+  *                                       replies that waited on the AI
+  *                       -> "err <id or -> <reason>"
+  *           replies for one session come in order, replies for different
+  *           sessions may overtake each other, match them on the id
+  *
+  *           pio run -e server && .pio/build/server/program [-s socket]
+  *                 [-n sessions] [-b batch us] [-r seed]
+  *
+*/
+
+#include "hal.h"
+#include "session.h"
+#include "mcts.h"
+#include "rng.h"
+
+#include <algorithm>
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+const uint8_t SLOT_BITS = 20;
+const uint32_t MAX_SESSIONS = 1UL << SLOT_BITS;
+const uint32_t SLOT_MASK = MAX_SESSIONS - 1;
+const size_t MAX_LINE = 64;            // longer request -> the connection is closed
+const size_t MAX_OUTPUT = 1 << 20;     // a client that stops reading is closed
+const int MAX_EVENTS = 256;
+const uint8_t LATENCY_BUCKETS = 32;    // log2 us
+const int8_t NO_CELL = -1;
+
+const char *const MODE_NAME[AI_MODES] = {"smart", "random", "mcts", "easy", "medium"};
+
+// sessions ------------------------------------------------------------------
+struct Slot {
+  GameSession game;
+  uint32_t gen;       // bumped on release, part of the id
+  uint32_t nextFree;  // free list, MAX_SESSIONS == end
+  int conn;           // owner, -1 == free
+  int8_t aiCell;      // the AI's last move, NO_CELL == none yet
+  bool queued;        // waiting in the AI batch
+  double asked;       // when the move that queued it came in, seconds
+};
+
+std::vector<Slot> slots;
+uint32_t freeHead = MAX_SESSIONS;
+uint32_t live;
+
+static void poolBegin(uint32_t size){
+  slots.resize(size);
+  for(uint32_t i = size; i-- > 0;){
+    slots[i].gen = 1;
+    slots[i].conn = -1;
+    slots[i].nextFree = freeHead;
+    freeHead = i;
+  }
+}
+
+static uint32_t poolId(uint32_t slot){
+  return slot | slots[slot].gen << SLOT_BITS;
+}
+
+// slot of a live id, NULL if it is free or was reused since
+static Slot *poolFind(uint32_t id){
+  uint32_t slot = id & SLOT_MASK;
+  if(slot >= slots.size() || slots[slot].conn < 0 || poolId(slot) != id)
+    return NULL;
+  return &slots[slot];
+}
+
+static Slot *poolAlloc(int conn){
+  if(freeHead == MAX_SESSIONS)
+    return NULL;
+  Slot &s = slots[freeHead];
+  freeHead = s.nextFree;
+  s.conn = conn;
+  s.aiCell = NO_CELL;
+  s.queued = false;
+  live++;
+  return &s;
+}
+
+static void poolRelease(Slot &s){
+  s.conn = -1;
+  s.gen = (s.gen + 1) & (UINT32_MAX >> SLOT_BITS);
+  if(!s.gen)
+    s.gen = 1;
+  s.nextFree = freeHead;
+  freeHead = &s - &slots[0];
+  live--;
+}
+
+// connections ---------------------------------------------------------------
+struct Conn {
+  int fd;             // -1 == closed
+  std::string in;     // bytes up to the next unparsed line
+  std::string out;    // replies not sent yet
+  std::vector<uint32_t> owned;  // ids made here, some may be ended already
+  bool wantOut;       // EPOLLOUT is on
+  bool held;          // stopped on a line for a queued session
+};
+
+std::vector<Conn> conns;   // by fd
+int epfd;
+
+// stats, latency is from the request to the reply for moves the AI answered
+uint64_t movesPlayed;
+uint64_t aiMoves;
+uint64_t batches;
+uint64_t latency[LATENCY_BUCKETS];
+double batchMaxUs;
+
+std::vector<uint32_t> aiQueue;
+size_t aiCarried;   // front of aiQueue left over from the last batch, sorted
+Rng serverRng;
+volatile sig_atomic_t stopping;
+
+static double now(){
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void watch(int fd, bool out){
+  epoll_event ev = {};
+  ev.events = EPOLLIN | (out ? (uint32_t)EPOLLOUT : 0);
+  ev.data.fd = fd;
+  epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev);
+  conns[fd].wantOut = out;
+}
+
+static void closeConn(int fd){
+  Conn &c = conns[fd];
+  for(uint32_t id : c.owned){
+    Slot *s = poolFind(id);
+    // a queued one is released when the batch gets to it
+    if(s && !s->queued)
+      poolRelease(*s);
+    else if(s)
+      s->conn = -2;
+  }
+  epoll_ctl(epfd, EPOLL_CTL_DEL, fd, NULL);
+  close(fd);
+  c.fd = -1;
+  c.in.clear();
+  c.out.clear();
+  c.owned.clear();
+  c.held = false;
+}
+
+static void flush(int fd){
+  Conn &c = conns[fd];
+  while(!c.out.empty()){
+    ssize_t n = send(fd, c.out.data(), c.out.size(), MSG_NOSIGNAL);
+    if(n < 0){
+      if(errno == EAGAIN || errno == EWOULDBLOCK)
+        break;
+      closeConn(fd);
+      return;
+    }
+    c.out.erase(0, n);
+  }
+  if(c.out.size() > MAX_OUTPUT){
+    closeConn(fd);
+    return;
+  }
+  if(c.out.empty() == c.wantOut)
+    watch(fd, !c.out.empty());
+}
+
+// replies -------------------------------------------------------------------
+static const char *state(const GameSession &g){
+  if(g.over)
+    return g.winner > 0 ? "xwins" : g.winner < 0 ? "owins" : "draw";
+  return bbXTurn(g.board) ? "x" : "o";
+}
+
+static void reply(Conn &c, uint32_t id, const Slot &s){
+  char board[BB_CELLS + 1];
+  for(uint8_t cell = 0; cell < BB_CELLS; cell++)
+    board[cell] = (s.game.board.x & bbBit(cell)) ? 'x' : (s.game.board.o & bbBit(cell)) ? 'o' : '.';
+  board[BB_CELLS] = 0;
+  char text[64];
+  if(s.aiCell == NO_CELL)
+    snprintf(text, sizeof(text), "%lu %s %s -\n", (unsigned long)id, board, state(s.game));
+  else
+    snprintf(text, sizeof(text), "%lu %s %s %d\n", (unsigned long)id, board, state(s.game), s.aiCell);
+  c.out += text;
+}
+
+static void error(Conn &c, const char *id, const char *reason){
+  c.out += "err ";
+  c.out += id ? id : "-";
+  c.out += " ";
+  c.out += reason;
+  c.out += "\n";
+}
+
+// a session that left the AI to move goes in the batch, the reply waits
+static void replyOrQueue(Conn &c, uint32_t id, Slot &s){
+  if(sessionAiToMove(s.game)){
+    s.queued = true;
+    s.asked = now();
+    aiQueue.push_back(id);
+  }else{
+    reply(c, id, s);
+  }
+}
+
+// requests ------------------------------------------------------------------
+// false -> the line has to wait for the batch, it stays in the buffer
+static bool request(int fd, char *line){
+  Conn &c = conns[fd];
+  char *words[4];
+  int count = 0;
+  for(char *w = strtok(line, " \t\r"); w && count < 4; w = strtok(NULL, " \t\r"))
+    words[count++] = w;
+  if(!count)
+    return true;
+
+  if(!strcmp(words[0], "stats")){
+    uint64_t total = 0, seen = 0;
+    for(uint8_t b = 0; b < LATENCY_BUCKETS; b++)
+      total += latency[b];
+    // upper edges of the log2 buckets
+    unsigned long p50 = 0, p99 = 0, max = 0;
+    for(uint8_t b = 0; b < LATENCY_BUCKETS; b++){
+      seen += latency[b];
+      if(!p50 && seen * 2 >= total && total)
+        p50 = 1UL << b;
+      if(!p99 && seen * 100 >= total * 99 && total)
+        p99 = 1UL << b;
+      if(latency[b])
+        max = 1UL << b;
+    }
+    char text[192];
+    snprintf(text, sizeof(text), "sessions %lu moves %llu ai %llu batches %llu batch_max_us %.0f p50_us %lu p99_us %lu max_us %lu\n",
+             (unsigned long)live, (unsigned long long)movesPlayed, (unsigned long long)aiMoves,
+             (unsigned long long)batches, batchMaxUs, p50, p99, max);
+    c.out += text;
+    return true;
+  }
+
+  if(!strcmp(words[0], "new")){
+    int mode = -1;
+    for(uint8_t m = 0; m < AI_MODES; m++){
+      if(count == 3 && !strcmp(words[1], MODE_NAME[m]))
+        mode = m;
+    }
+    bool twoPlayer = count == 3 && !strcmp(words[1], "2p");
+    bool humanX = count == 3 && !strcmp(words[2], "x");
+    if((mode < 0 && !twoPlayer) || (!humanX && (count != 3 || strcmp(words[2], "o")))){
+      error(c, NULL, "usage new <mode> <x|o>");
+      return true;
+    }
+    Slot *s = poolAlloc(fd);
+    if(!s){
+      error(c, NULL, "full");
+      return true;
+    }
+    uint32_t id = poolId(s - &slots[0]);
+    rngSeed(s->game.rng, rngNext(serverRng));
+    sessionBegin(s->game, twoPlayer ? AI_SMART : mode, twoPlayer, !humanX && !twoPlayer);
+    // ended ones are dropped now and then, a kiosk keeps its connection
+    if(c.owned.size() >= 64 && c.owned.size() % 64 == 0){
+      c.owned.erase(std::remove_if(c.owned.begin(), c.owned.end(),
+                                   [](uint32_t owned){ return !poolFind(owned); }), c.owned.end());
+    }
+    c.owned.push_back(id);
+    replyOrQueue(c, id, *s);
+    return true;
+  }
+
+  if(count < 2 || (strcmp(words[0], "move") && strcmp(words[0], "show") && strcmp(words[0], "end"))){
+    error(c, NULL, "unknown request");
+    return true;
+  }
+  char *end;
+  unsigned long id = strtoul(words[1], &end, 10);
+  Slot *s = *end ? NULL : poolFind(id);
+  if(!s || s->conn != fd){
+    error(c, words[1], "no such session");
+    return true;
+  }
+  if(s->queued)
+    return false;
+
+  if(!strcmp(words[0], "end")){
+    poolRelease(*s);
+    c.out += words[1];
+    c.out += " end\n";
+  }else if(!strcmp(words[0], "show")){
+    reply(c, id, *s);
+  }else{
+    long cell = count == 3 ? strtol(words[2], &end, 10) : -1;
+    if(count != 3 || *end || cell < 0 || cell >= BB_CELLS){
+      error(c, words[1], "usage move <id> <cell>");
+    }else if(sessionAiToMove(s->game) || !sessionPlay(s->game, cell)){
+      error(c, words[1], s->game.over ? "game over" : "illegal move");
+    }else{
+      movesPlayed++;
+      replyOrQueue(c, id, *s);
+    }
+  }
+  return true;
+}
+
+// every whole line in the buffer, up to one that has to wait
+static void parse(int fd){
+  Conn &c = conns[fd];
+  c.held = false;
+  size_t start = 0;
+  for(;;){
+    size_t nl = c.in.find('\n', start);
+    if(nl == std::string::npos)
+      break;
+    std::string line = c.in.substr(start, nl - start);
+    if(!request(fd, &line[0])){
+      c.held = true;
+      break;
+    }
+    if(conns[fd].fd < 0)
+      return;
+    start = nl + 1;
+  }
+  c.in.erase(0, start);
+  if(!c.held && c.in.size() > MAX_LINE)
+    closeConn(fd);
+}
+
+static void readConn(int fd){
+  char buf[4096];
+  for(;;){
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if(n > 0){
+      conns[fd].in.append(buf, n);
+      if(conns[fd].in.size() > MAX_OUTPUT){
+        closeConn(fd);
+        return;
+      }
+      continue;
+    }
+    if(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      break;
+    closeConn(fd);
+    return;
+  }
+  if(!conns[fd].held)
+    parse(fd);
+}
+
+// batch ---------------------------------------------------------------------
+static bool batchOrder(uint32_t a, uint32_t b){
+  const GameSession &ga = slots[a & SLOT_MASK].game;
+  const GameSession &gb = slots[b & SLOT_MASK].game;
+  if(ga.aiMode != gb.aiMode)
+    return ga.aiMode < gb.aiMode;
+  if(ga.board.x != gb.board.x)
+    return ga.board.x < gb.board.x;
+  return ga.board.o < gb.board.o;
+}
+
+// AI moves of the queue for at most budgetUs, the rest wait for next time
+static void runBatch(unsigned long budgetUs){
+  if(aiQueue.empty())
+    return;
+  double start = now();
+  // what the last batch left goes first, so nothing waits more than a few
+  std::sort(aiQueue.begin() + aiCarried, aiQueue.end(), batchOrder);
+  // the last deterministic answer, sorting puts equal positions together
+  bool haveLast = false;
+  uint8_t lastMode = 0;
+  Board lastBoard = {0, 0};
+  int lastCell = NO_CELL;
+
+  size_t done = 0;
+  std::vector<int> touched;
+  while(done < aiQueue.size()){
+    Slot &s = slots[aiQueue[done] & SLOT_MASK];
+    uint32_t id = aiQueue[done++];
+    bool reuse = s.game.aiMode != AI_RANDOM && s.game.aiMode != AI_MCTS;
+    int cell;
+    if(reuse && haveLast && lastMode == s.game.aiMode && bbEqual(lastBoard, s.game.board)){
+      cell = lastCell;
+    }else{
+      sessionAiStep(s.game, UINT32_MAX, cell);
+      haveLast = reuse;
+      lastMode = s.game.aiMode;
+      lastBoard = s.game.board;
+      lastCell = cell;
+    }
+    sessionPlay(s.game, cell);
+    s.aiCell = cell;
+    s.queued = false;
+    aiMoves++;
+    if(s.conn == -2){
+      // its connection went while it was queued
+      poolRelease(s);
+    }else{
+      reply(conns[s.conn], id, s);
+      touched.push_back(s.conn);
+      double us = (now() - s.asked) * 1e6;
+      uint8_t b = 0;
+      while(b < LATENCY_BUCKETS - 1 && (1UL << b) < us)
+        b++;
+      latency[b]++;
+    }
+    if((now() - start) * 1e6 >= budgetUs)
+      break;
+  }
+  aiQueue.erase(aiQueue.begin(), aiQueue.begin() + done);
+  aiCarried = aiQueue.size();
+  batches++;
+  batchMaxUs = std::max(batchMaxUs, (now() - start) * 1e6);
+
+  // held lines can go on now, and the replies out
+  std::sort(touched.begin(), touched.end());
+  touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+  for(int fd : touched){
+    if(conns[fd].fd < 0)
+      continue;
+    if(conns[fd].held)
+      parse(fd);
+    if(conns[fd].fd >= 0)
+      flush(fd);
+  }
+}
+
+// main ----------------------------------------------------------------------
+static void onSignal(int){
+  stopping = 1;
+}
+
+static void usage(){
+  fprintf(stderr, "usage: server [-s socket] [-n sessions] [-b batch us] [-r seed]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  const char *path = "/tmp/tictactoe.sock";
+  unsigned long sessions = 65536;
+  unsigned long budgetUs = 2000;
+  uint32_t seed = (uint32_t)time(NULL);
+  for(int i = 1; i < argc; i++){
+    if(i + 1 >= argc)
+      usage();
+    if(!strcmp(argv[i], "-s"))
+      path = argv[++i];
+    else if(!strcmp(argv[i], "-n"))
+      sessions = strtoul(argv[++i], NULL, 10);
+    else if(!strcmp(argv[i], "-b"))
+      budgetUs = strtoul(argv[++i], NULL, 10);
+    else if(!strcmp(argv[i], "-r"))
+      seed = strtoul(argv[++i], NULL, 10);
+    else
+      usage();
+  }
+  if(!sessions || sessions > MAX_SESSIONS){
+    fprintf(stderr, "server: 1 - %lu sessions\n", (unsigned long)MAX_SESSIONS);
+    return 2;
+  }
+  poolBegin(sessions);
+  rngSeed(serverRng, seed);
+  mctsSeed(seed);
+
+  int listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  sockaddr_un addr = {};
+  addr.sun_family = AF_UNIX;
+  if(strlen(path) >= sizeof(addr.sun_path)){
+    fprintf(stderr, "server: socket path too long\n");
+    return 2;
+  }
+  strcpy(addr.sun_path, path);
+  unlink(path);
+  if(listener < 0 || bind(listener, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(listener, SOMAXCONN) < 0){
+    perror("server");
+    return 1;
+  }
+  epfd = epoll_create1(EPOLL_CLOEXEC);
+  epoll_event ev = {};
+  ev.events = EPOLLIN;
+  ev.data.fd = listener;
+  epoll_ctl(epfd, EPOLL_CTL_ADD, listener, &ev);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+  signal(SIGPIPE, SIG_IGN);
+  printf("server on %s, %lu sessions\n", path, sessions);
+  fflush(stdout);
+
+  epoll_event events[MAX_EVENTS];
+  while(!stopping){
+    // don't sleep while AI moves are waiting
+    int n = epoll_wait(epfd, events, MAX_EVENTS, aiQueue.empty() ? -1 : 0);
+    if(n < 0 && errno != EINTR)
+      break;
+    for(int i = 0; i < n; i++){
+      int fd = events[i].data.fd;
+      if(fd == listener){
+        int client;
+        while((client = accept4(listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0){
+          if((size_t)client >= conns.size())
+            conns.resize(client + 1, Conn{-1, "", "", {}, false, false});
+          conns[client].fd = client;
+          conns[client].wantOut = false;
+          epoll_event cev = {};
+          cev.events = EPOLLIN;
+          cev.data.fd = client;
+          epoll_ctl(epfd, EPOLL_CTL_ADD, client, &cev);
+        }
+        continue;
+      }
+      if(conns[fd].fd < 0)
+        continue;
+      if(events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+        readConn(fd);
+      if(conns[fd].fd >= 0)
+        flush(fd);
+    }
+    runBatch(budgetUs);
+  }
+
+  close(listener);
+  unlink(path);
+  printf("%llu moves, %llu AI moves in %llu batches\n", (unsigned long long)movesPlayed,
+         (unsigned long long)aiMoves, (unsigned long long)batches);
+  return 0;
+}
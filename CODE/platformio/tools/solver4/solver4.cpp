@@ -0,0 +1,383 @@
+/*
+  *@solver4 overview
+  *           host tool, solves 4x4 tic-tac-toe (four in a row) completely by
+  *           retrograde analysis and writes an opening book header that the
+  *           firmware can keep in flash
+  *           a position is indexed like movetable.h, base 3 with cell c as
+  *           digit c (empty == 0, X == 1, O == 2), cell (x,y) == bit x*4 + y
+  *                 |-> 3^16 states, two memory mapped files in -d dir
+  *                     results.bin   2 bits per state, result for the side
+  *                                   to move (0 unknown, 1 win, 2 loss, 3 draw)
+  *                     distance.bin  1 byte per state, plies to the end with
+  *                                   best play (quickest win, slowest loss)
+  *                 |-> solved one layer (piece count) at a time from the full
+  *                     board down, a layer only reads the one above it, so
+  *                     all cores split a layer between them
+  *           the book holds every symmetry reduced position with at most
+  *           -p pieces (openings) or at most -e empty cells (endgames)
+  *
+  *           pio run -e solver4 && .pio/build/solver4/program
+  *                 [-t threads] [-d dir] [-p plies] [-e empties] [-r]
+  *                 [-o include/book4.h]
+  *           -r reuses results from an earlier run in dir
+  *
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+const int SIZE = 4;
+const int CELLS = 16;
+const uint32_t STATES = 43046721; // 3^16
+const uint32_t FULL = 0xFFFF;
+const int NUM_LINES = 10;
+const int NUM_SYMS = 8;
+
+// rows, columns, (0,0)->(3,3) and (0,3)->(3,0)
+const uint16_t LINES[NUM_LINES] = {
+        0x000F, 0x00F0, 0x0F00, 0xF000,
+        0x1111, 0x2222, 0x4444, 0x8888,
+        0x8421, 0x1248
+  };
+
+enum Result { UNKNOWN = 0, WIN = 1, LOSS = 2, DRAW = 3 };
+
+uint32_t base3[1 << CELLS]; // mask -> sum of 3^cell over its bits
+uint8_t *results;           // 2 bits per state
+uint8_t *distance;          // plies to the end
+
+static bool hasLine(uint32_t m){
+  for(int i = 0; i < NUM_LINES; i++){
+    if((m & LINES[i]) == LINES[i])
+      return true;
+  }
+  return false;
+}
+static uint32_t stateIndex(uint32_t x, uint32_t o){
+  return base3[x] + 2*base3[o];
+}
+static Result getResult(uint32_t idx){
+  return (Result)((results[idx >> 2] >> ((idx & 3) * 2)) & 3);
+}
+static void setResult(uint32_t idx, Result r){
+  // neighbours in the same byte belong to other threads, the file starts
+  // zeroed so an atomic or is enough
+  __atomic_fetch_or(&results[idx >> 2], (uint8_t)(r << ((idx & 3) * 2)), __ATOMIC_RELAXED);
+}
+
+// spread the low bits of bits over the set bits of mask
+static uint32_t deposit(uint32_t bits, uint32_t mask){
+  uint32_t out = 0;
+  for(uint32_t m = mask; m; m &= m - 1){
+    if(bits & 1)
+      out |= m & -m;
+    bits >>= 1;
+  }
+  return out;
+}
+// next number with the same count of set bits (Gosper)
+static uint32_t nextCombination(uint32_t v){
+  uint32_t c = v & -v;
+  uint32_t r = v + c;
+  return (((r ^ v) >> 2) / c) | r;
+}
+
+// every o mask with count bits that does not overlap x
+template <class F> static void forEachO(uint32_t x, int count, F f){
+  if(count == 0){
+    f(0u);
+    return;
+  }
+  uint32_t free = ~x & FULL;
+  int freeCount = __builtin_popcount(free);
+  for(uint32_t bits = (1u << count) - 1; bits < (1u << freeCount); bits = nextCombination(bits))
+    f(deposit(bits, free));
+}
+
+// best move of a non terminal position, children must be solved already
+static void bestMove(uint32_t x, uint32_t o, int &cell, Result &result, uint8_t &plies){
+  bool xTurn = __builtin_popcount(x) == __builtin_popcount(o);
+  uint32_t idx = stateIndex(x, o);
+  uint32_t digit = xTurn ? 1 : 2;
+  uint32_t empty = ~(x | o) & FULL;
+  cell = -1;
+  result = LOSS;
+  plies = 0;
+  uint32_t pow3 = 1;
+  for(int c = 0; c < CELLS; c++, pow3 *= 3){
+    if(!(empty & (1u << c)))
+      continue;
+    uint32_t child = idx + digit*pow3;
+    Result r = getResult(child);
+    uint8_t d = distance[child] + 1;
+    // the child is seen from the other side
+    Result mine = r == LOSS ? WIN : r == WIN ? LOSS : DRAW;
+    bool better;
+    if(cell < 0){
+      better = true;
+    }else if(mine != result){
+      better = mine == WIN || (mine == DRAW && result == LOSS);
+    }else{
+      // quickest win, slowest loss, draws are all the same
+      better = (mine == WIN && d < plies) || (mine == LOSS && d > plies);
+    }
+    if(better){
+      cell = c;
+      result = mine;
+      plies = mine == DRAW ? 0 : d;
+    }
+  }
+}
+
+static void solveState(uint32_t x, uint32_t o, int pieces){
+  uint32_t idx = stateIndex(x, o);
+  if(hasLine(x) || hasLine(o)){
+    // the last move won
+    setResult(idx, LOSS);
+    distance[idx] = 0;
+    return;
+  }
+  if(pieces == CELLS){
+    setResult(idx, DRAW);
+    distance[idx] = 0;
+    return;
+  }
+  int cell;
+  Result r;
+  uint8_t plies;
+  bestMove(x, o, cell, r, plies);
+  setResult(idx, r);
+  distance[idx] = plies;
+}
+
+// every position with this many pieces that the move count allows
+static void solveLayer(int pieces, unsigned threads){
+  int xCount = (pieces + 1) / 2;
+  int oCount = pieces / 2;
+  std::vector<uint32_t> xs;
+  for(uint32_t x = 0; x <= FULL; x++){
+    if(__builtin_popcount(x) == xCount)
+      xs.push_back(x);
+  }
+  std::atomic<size_t> next(0);
+  auto work = [&](){
+    size_t i;
+    while((i = next++) < xs.size()){
+      uint32_t x = xs[i];
+      forEachO(x, oCount, [&](uint32_t o){ solveState(x, o, pieces); });
+    }
+  };
+  std::vector<std::thread> pool;
+  for(unsigned t = 1; t < threads; t++)
+    pool.emplace_back(work);
+  work();
+  for(std::thread &t : pool)
+    t.join();
+}
+
+static void *mapFile(const std::string &path, size_t size, bool reuse){
+  int fd = open(path.c_str(), O_RDWR | O_CREAT | (reuse ? 0 : O_TRUNC), 0644);
+  if(fd < 0){
+    perror(path.c_str());
+    exit(1);
+  }
+  struct stat st;
+  if(reuse && (fstat(fd, &st) != 0 || (size_t)st.st_size != size)){
+    fprintf(stderr, "%s is not from an earlier run, drop -r\n", path.c_str());
+    exit(1);
+  }
+  if(!reuse && ftruncate(fd, size) != 0){
+    perror("ftruncate");
+    exit(1);
+  }
+  void *p = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if(p == MAP_FAILED){
+    perror("mmap");
+    exit(1);
+  }
+  close(fd);
+  return p;
+}
+
+// symmetries -> bit 0 mirrors left/right, bit 1 mirrors top/bottom and
+// bit 2 swaps x and y, applied in that order (same as bitboard.h)
+int symCell[NUM_SYMS][CELLS];
+
+static void buildSymmetries(){
+  for(int sym = 0; sym < NUM_SYMS; sym++){
+    for(int c = 0; c < CELLS; c++){
+      int x = c / SIZE, y = c % SIZE;
+      if(sym & 1)
+        y = SIZE - 1 - y;
+      if(sym & 2)
+        x = SIZE - 1 - x;
+      if(sym & 4)
+        std::swap(x, y);
+      symCell[sym][c] = x*SIZE + y;
+    }
+  }
+}
+static uint32_t transform(uint32_t m, int sym){
+  uint32_t out = 0;
+  for(int c = 0; c < CELLS; c++){
+    if(m & (1u << c))
+      out |= 1u << symCell[sym][c];
+  }
+  return out;
+}
+static uint32_t bookKey(uint32_t x, uint32_t o){
+  return x << 16 | o;
+}
+static uint32_t canonicalKey(uint32_t x, uint32_t o){
+  uint32_t best = bookKey(x, o);
+  for(int sym = 1; sym < NUM_SYMS; sym++)
+    best = std::min(best, bookKey(transform(x, sym), transform(o, sym)));
+  return best;
+}
+
+struct BookEntry {
+  uint32_t key;
+  uint16_t info;
+};
+
+static void writeBook(const char *path, int plies, int empties){
+  std::vector<BookEntry> book;
+  for(int pieces = 0; pieces <= CELLS; pieces++){
+    if(pieces > plies && CELLS - pieces > empties)
+      continue;
+    int xCount = (pieces + 1) / 2;
+    int oCount = pieces / 2;
+    for(uint32_t x = 0; x <= FULL; x++){
+      if(__builtin_popcount(x) != xCount)
+        continue;
+      forEachO(x, oCount, [&](uint32_t o){
+        if(hasLine(x) || hasLine(o) || pieces == CELLS)
+          return;
+        if(canonicalKey(x, o) != bookKey(x, o))
+          return;
+        int cell;
+        Result r;
+        uint8_t d;
+        bestMove(x, o, cell, r, d);
+        book.push_back({bookKey(x, o), (uint16_t)(cell | r << 4 | d << 6)});
+      });
+    }
+  }
+  std::sort(book.begin(), book.end(), [](const BookEntry &a, const BookEntry &b){ return a.key < b.key; });
+
+  char endgame[32] = "";
+  if(empties > 0)
+    snprintf(endgame, sizeof(endgame), " or %d empty cells", empties);
+
+  FILE *f = fopen(path, "w");
+  if(!f){
+    perror(path);
+    exit(1);
+  }
+  fprintf(f, "/*\n"
+             "  *@book4 overview\n"
+             "  *           GENERATED by tools/solver4, do not edit\n"
+             "  *           perfect play for 4x4 tic-tac-toe (four in a row), every\n"
+             "  *           position with at most %d pieces%s that the game\n"
+             "  *           is not over in, one per symmetry class\n"
+             "  *                 |-> key  == x mask << 16 | o mask, cell (x,y) == bit x*4 + y\n"
+             "  *                     only the smallest key over the 8 symmetries is\n"
+             "  *                     stored (same symmetry order as bitboard.h),\n"
+             "  *                     sorted for a binary search\n"
+             "  *                 |-> info == best cell of the stored key (bits 0-3)\n"
+             "  *                            | result for the side to move (bits 4-5,\n"
+             "  *                              1 win, 2 loss, 3 draw)\n"
+             "  *                            | plies to the end (bits 6-10)\n"
+             "  *           %zu entries, %zu bytes of flash\n"
+             "  *\n"
+             "*/\n\n"
+             "#ifndef BOOK4_H\n#define BOOK4_H\n\n#include <stdint.h>\n#include \"hal.h\"\n\n",
+          plies, endgame, book.size(), book.size() * (sizeof(uint32_t) + sizeof(uint16_t)));
+  fprintf(f, "const uint8_t BOOK4_PLIES = %d;\nconst uint8_t BOOK4_EMPTIES = %d;\nconst uint16_t BOOK4_SIZE = %zu;\n\n",
+          plies, empties, book.size());
+  fprintf(f, "const uint32_t BOOK4_KEYS[BOOK4_SIZE] PROGMEM = {");
+  for(size_t i = 0; i < book.size(); i++)
+    fprintf(f, "%s0x%08x,", i % 8 ? " " : "\n        ", book[i].key);
+  fprintf(f, "\n  };\n\nconst uint16_t BOOK4_INFO[BOOK4_SIZE] PROGMEM = {");
+  for(size_t i = 0; i < book.size(); i++)
+    fprintf(f, "%s0x%04x,", i % 12 ? " " : "\n        ", book[i].info);
+  fprintf(f, "\n  };\n\n#endif\n");
+  fclose(f);
+  printf("book: %zu positions -> %s\n", book.size(), path);
+}
+
+static void usage(){
+  fprintf(stderr, "usage: solver4 [-t threads] [-d dir] [-p plies] [-e empties] [-r] [-o book.h]\n");
+  exit(2);
+}
+
+int main(int argc, char **argv){
+  unsigned threads = std::thread::hardware_concurrency();
+  std::string dir = ".";
+  const char *out = "include/book4.h";
+  int plies = 5;
+  int empties = 0;
+  bool reuse = false;
+  for(int i = 1; i < argc; i++){
+    if(!strcmp(argv[i], "-r")){
+      reuse = true;
+      continue;
+    }
+    if(i + 1 >= argc)
+      usage();
+    if(!strcmp(argv[i], "-t"))
+      threads = strtoul(argv[++i], NULL, 0);
+    else if(!strcmp(argv[i], "-d"))
+      dir = argv[++i];
+    else if(!strcmp(argv[i], "-p"))
+      plies = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-e"))
+      empties = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "-o"))
+      out = argv[++i];
+    else
+      usage();
+  }
+  if(threads == 0)
+    threads = 1;
+
+  for(uint32_t m = 0; m <= FULL; m++){
+    uint32_t v = 0, pow3 = 1;
+    for(int c = 0; c < CELLS; c++, pow3 *= 3){
+      if(m & (1u << c))
+        v += pow3;
+    }
+    base3[m] = v;
+  }
+  buildSymmetries();
+  results = (uint8_t *)mapFile(dir + "/results.bin", (STATES + 3) / 4, reuse);
+  distance = (uint8_t *)mapFile(dir + "/distance.bin", STATES, reuse);
+
+  if(!reuse){
+    auto start = std::chrono::steady_clock::now();
+    for(int pieces = CELLS; pieces >= 0; pieces--){
+      solveLayer(pieces, threads);
+      printf("layer %2d solved\n", pieces);
+      fflush(stdout);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("solved in %.1fs on %u threads\n", seconds, threads);
+  }
+
+  static const char *NAMES[] = {"unknown", "win", "loss", "draw"};
+  printf("empty board: %s for X in %d plies\n", NAMES[getResult(0)], distance[0]);
+  writeBook(out, plies, empties);
+  return 0;
+}
@@ -0,0 +1,59 @@
+# PlatformIO extra script, fails the build when the linked image uses more
+# SRAM (.data + .bss + .noinit) or flash than custom_sram_budget /
+# custom_flash_budget in platformio.ini, and prints where the SRAM went
+
+import subprocess
+
+Import("env")
+
+SRAM_SECTIONS = (".data", ".bss", ".noinit")
+FLASH_SECTIONS = (".text", ".data")
+TOP_SYMBOLS = 12
+
+
+def section_sizes(elf):
+    out = subprocess.check_output([env.subst("$SIZETOOL"), "-A", elf], text=True)
+    sizes = {}
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) >= 2 and parts[0].startswith(".") and parts[1].isdigit():
+            sizes[parts[0]] = int(parts[1])
+    return sizes
+
+
+def sram_symbols(elf):
+    nm = env.subst("$SIZETOOL").replace("size", "nm")
+    out = subprocess.check_output([nm, "--size-sort", "-S", "-C", elf], text=True)
+    symbols = []
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "bBdD":
+            symbols.append((int(parts[1], 16), parts[3]))
+    return sorted(symbols, reverse=True)[:TOP_SYMBOLS]
+
+
+def check_budget(source, target, env):
+    elf = str(target[0])
+    sizes = section_sizes(elf)
+    sram = sum(sizes.get(s, 0) for s in SRAM_SECTIONS)
+    flash = sum(sizes.get(s, 0) for s in FLASH_SECTIONS)
+    sram_budget = int(env.GetProjectOption("custom_sram_budget", "0"))
+    flash_budget = int(env.GetProjectOption("custom_flash_budget", "0"))
+
+    print("SRAM  %5d / %d bytes (static, the rest is stack)" % (sram, sram_budget))
+    print("Flash %5d / %d bytes" % (flash, flash_budget))
+    for size, name in sram_symbols(elf):
+        print("  %5d  %s" % (size, name))
+
+    failed = False
+    if sram_budget and sram > sram_budget:
+        print("Error: SRAM budget exceeded by %d bytes" % (sram - sram_budget))
+        failed = True
+    if flash_budget and flash > flash_budget:
+        print("Error: flash budget exceeded by %d bytes" % (flash - flash_budget))
+        failed = True
+    if failed:
+        env.Exit(1)
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", check_budget)